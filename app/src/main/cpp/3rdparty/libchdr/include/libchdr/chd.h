@@ -303,6 +303,18 @@ typedef enum _chd_error chd_error;
 typedef struct _chd_file chd_file;
 
 
+/* cache for hunks read from parent files, which may be shared between several chd_files */
+typedef struct _chd_hunk_cache chd_hunk_cache;
+struct _chd_hunk_cache
+{
+	void *param;
+	/* copies the hunk into dest and returns nonzero if it is cached */
+	int (*lookup)(void *param, const uint8_t *sha1, uint32_t hunknum, void *dest, uint32_t hunkbytes);
+	/* offers a freshly decompressed hunk to the cache */
+	void (*store)(void *param, const uint8_t *sha1, uint32_t hunknum, const void *src, uint32_t hunkbytes);
+};
+
+
 /* extract header structure (NOT the on-disk header structure) */
 typedef struct _chd_header chd_header;
 struct _chd_header
@@ -388,6 +400,9 @@ CHD_EXPORT void chd_close(chd_file *chd);
 /* return the associated core_file */
 CHD_EXPORT core_file *chd_core_file(chd_file *chd);
 
+/* use a cache for hunks read from the parents of this file, the cache must outlive the file */
+CHD_EXPORT void chd_set_parent_hunk_cache(chd_file *chd, const chd_hunk_cache *cache);
+
 /* return an error string for the given CHD error */
 CHD_EXPORT const char *chd_error_string(chd_error err);
 
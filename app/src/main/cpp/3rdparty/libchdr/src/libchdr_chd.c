@@ -308,6 +308,7 @@ struct _chd_file
 	chd_header				header;			/* header, extracted from file */
 
 	chd_file *				parent;			/* pointer to parent file, or NULL */
+	const chd_hunk_cache *	parent_hunk_cache;	/* cache for hunks read from the parent, or NULL */
 
 	map_entry *				map;			/* array of map entries */
 
@@ -368,6 +369,7 @@ static chd_error header_read(chd_file *chd, chd_header *header);
 static chd_error hunk_read_into_cache(chd_file *chd, uint32_t hunknum);
 #endif
 static chd_error hunk_read_into_memory(chd_file *chd, uint32_t hunknum, uint8_t *dest);
+static chd_error hunk_read_from_parent(chd_file *chd, uint32_t hunknum, uint8_t *dest);
 
 /* internal map access */
 static chd_error map_read(chd_file *chd);
@@ -2269,6 +2271,17 @@ CHD_EXPORT core_file *chd_core_file(chd_file *chd)
 	return chd->file;
 }
 
+/*-------------------------------------------------
+    chd_set_parent_hunk_cache - use a cache for
+    hunks read from the parents of a file
+-------------------------------------------------*/
+
+CHD_EXPORT void chd_set_parent_hunk_cache(chd_file *chd, const chd_hunk_cache *cache)
+{
+	for (; chd != NULL; chd = chd->parent)
+		chd->parent_hunk_cache = cache;
+}
+
 /*-------------------------------------------------
     chd_error_string - return an error string for
     the given CHD error
@@ -2853,6 +2866,26 @@ static chd_error hunk_read_into_cache(chd_file *chd, uint32_t hunknum)
 }
 #endif
 
+/*-------------------------------------------------
+    hunk_read_from_parent - read a hunk from the
+    parent of a file, through the parent hunk cache
+-------------------------------------------------*/
+
+static chd_error hunk_read_from_parent(chd_file *chd, uint32_t hunknum, uint8_t *dest)
+{
+	const chd_hunk_cache *cache = chd->parent_hunk_cache;
+	chd_file *parent = chd->parent;
+	chd_error err;
+
+	if (cache != NULL && cache->lookup(cache->param, parent->header.sha1, hunknum, dest, parent->header.hunkbytes))
+		return CHDERR_NONE;
+
+	err = hunk_read_into_memory(parent, hunknum, dest);
+	if (err == CHDERR_NONE && cache != NULL)
+		cache->store(cache->param, parent->header.sha1, hunknum, dest, parent->header.hunkbytes);
+	return err;
+}
+
 /*-------------------------------------------------
     hunk_read_into_memory - read a hunk into
     memory at the given location
@@ -2928,7 +2961,7 @@ static chd_error hunk_read_into_memory(chd_file *chd, uint32_t hunknum, uint8_t
 
 			/* parent-referenced data */
 			case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
-				err = hunk_read_into_memory(chd->parent, entry->offset, dest);
+				err = hunk_read_from_parent(chd, entry->offset, dest);
 				if (err != CHDERR_NONE)
 					return err;
 				break;
@@ -3053,20 +3086,20 @@ static chd_error hunk_read_into_memory(chd_file *chd, uint32_t hunknum, uint8_t
 
 				/* blockoffs is aligned to units_in_hunk */
 				if (blockoffs % units_in_hunk == 0) {
-					return hunk_read_into_memory(chd->parent, blockoffs / units_in_hunk, dest);
+					return hunk_read_from_parent(chd, blockoffs / units_in_hunk, dest);
 				/* blockoffs is not aligned to units_in_hunk */
 				} else {
 					uint32_t unit_in_hunk = blockoffs % units_in_hunk;
 					uint8_t *buf = malloc(chd->header.hunkbytes);
 					/* Read first half of hunk which contains blockoffs */
-					err = hunk_read_into_memory(chd->parent, blockoffs / units_in_hunk, buf);
+					err = hunk_read_from_parent(chd, blockoffs / units_in_hunk, buf);
 					if (err != CHDERR_NONE) {
 						free(buf);
 						return err;
 					}
 					memcpy(dest, buf + unit_in_hunk * chd->header.unitbytes, (units_in_hunk - unit_in_hunk) * chd->header.unitbytes);
 					/* Read second half of hunk which contains blockoffs */
-					err = hunk_read_into_memory(chd->parent, (blockoffs / units_in_hunk) + 1, buf);
+					err = hunk_read_from_parent(chd, (blockoffs / units_in_hunk) + 1, buf);
 					if (err != CHDERR_NONE) {
 						free(buf);
 						return err;
@@ -8,6 +8,7 @@ include(GNUInstallDirs)
 #-------------------------------------------------------------------------------
 option(ENABLE_TESTS "Enables building the unit tests" ON)
 option(ENABLE_GSRUNNER "Enables building the GSRunner by default.  It can still be built with `make pcsx2-gsrunner` otherwise." OFF)
+option(ENABLE_ISOCONV "Enables building pcsx2-isoconv, which converts disc images to the zstd seekable format" ON)
 option(LTO_PCSX2_CORE "Enable LTO/IPO/LTCG on the subset of pcsx2 that benefits most from it but not anything else")
 option(USE_VTUNE "Plug VTUNE to profile GS JIT.")
 option(PACKAGE_MODE "Use this option to ease packaging of PCSX2 (developer/distribution option)")
@@ -81,7 +82,6 @@ target_architecture(CMAKE_HOST_SYSTEM_PROCESSOR)
 #-------------------------------------------------------------------------------
 if("${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "x86_64" OR "${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "amd64" OR
    "${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "AMD64" OR "${CMAKE_OSX_ARCHITECTURES}" STREQUAL "x86_64")
-	# Multi-ISA only exists on x86.
 	option(DISABLE_ADVANCE_SIMD "Disable advance use of SIMD (SSE2+ & AVX)" OFF)
 
 	list(APPEND PCSX2_DEFS _M_X86=1)
@@ -113,7 +113,14 @@ if("${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "x86_64" OR "${CMAKE_HOST_SYSTEM_PR
 	endif()
 elseif("${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "arm64" OR "${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "aarch64" OR
        "${CMAKE_OSX_ARCHITECTURES}" STREQUAL "arm64")
-	message(STATUS "Building for Apple Silicon (ARM64).")
+	# Multi-ISA on ARM64 builds plain NEON and paired-register (neon256) variants of the GS kernels.
+	option(DISABLE_ADVANCE_SIMD "Build NEON and NEON256 variants of the GS kernels and select at runtime" OFF)
+
+	if(DISABLE_ADVANCE_SIMD)
+		message(STATUS "Building for Apple Silicon (ARM64) (Multi-ISA).")
+	else()
+		message(STATUS "Building for Apple Silicon (ARM64).")
+	endif()
 	list(APPEND PCSX2_DEFS _M_ARM64=1)
 	set(_M_ARM64 TRUE)
 #	add_compile_options("-march=armv8.4-a" "-mcpu=apple-m1")
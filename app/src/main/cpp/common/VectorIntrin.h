@@ -37,6 +37,13 @@
 
 #elif defined(_M_ARM64)
 #include <arm_neon.h>
+
+// 0x200 enables the GSVector8/GSVector8i paths using pairs of 128-bit registers.
+// Set by the build for the neon256 multi-isa variant, see MultiISA.h.
+#ifndef _M_NEON
+#define _M_NEON 0x100
+#endif
+
 #endif
 
 #ifdef __APPLE__
@@ -0,0 +1,831 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Achievements.h"
+#include "pcsx2/GS.h"
+#include "pcsx2/GS/GS.h"
+#include "pcsx2/GS/GSPerfMon.h"
+#include "pcsx2/GS/MultiISA.h"
+#include "pcsx2/GS/Renderers/HW/GSTextureReplacements.h"
+#include "pcsx2/GSDumpReplayer.h"
+#include "pcsx2/GameList.h"
+#include "pcsx2/Host.h"
+#include "pcsx2/ImGui/FullscreenUI.h"
+#include "pcsx2/ImGui/ImGuiFullscreen.h"
+#include "pcsx2/ImGui/ImGuiManager.h"
+#include "pcsx2/Input/InputManager.h"
+#include "pcsx2/PerformanceMetrics.h"
+#include "pcsx2/SIO/Pad/Pad.h"
+#include "pcsx2/VMManager.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/MemorySettingsInterface.h"
+#include "common/Path.h"
+#include "common/ProgressCallback.h"
+#include "common/SmallString.h"
+#include "common/StringUtil.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
+#include "common/WindowInfo.h"
+
+#include "fmt/format.h"
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace GSRunner
+{
+	static void PrintCommandLineHelp(const char* progname);
+	static bool ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& params);
+	static bool InitializeConfig();
+	static bool SeekToStartFrame();
+	static void RunVM(const VMBootParameters& params);
+	static bool WriteReport(const std::string& dump_path);
+} // namespace GSRunner
+
+static MemorySettingsInterface s_settings_interface;
+
+static GSRendererType s_renderer = GSRendererType::SW;
+static s32 s_loop_count = 1;
+static u32 s_start_frame = 0;
+static std::optional<u32> s_sw_threads;
+static std::string s_output_path;
+static std::string s_pack_textures_dir;
+static u32 s_bench_swizzle_iterations = 0;
+
+/// Names for the GSPerfMon counters in the report, in enum order.
+static constexpr std::array<const char*, GSPerfMon::CounterLast> s_counter_names = {{
+	"prims",
+	"draws",
+	"draw_calls",
+	"readbacks",
+	"swizzle",
+	"unswizzle",
+	"fillrate",
+	"sync_points",
+	"sync_avoided",
+	"barriers",
+	"render_passes",
+}};
+
+struct FrameStats
+{
+	u64 frame;
+	double wall_ms;
+	double gs_cpu_ms;
+	std::array<double, GSPerfMon::CounterLast> counters;
+};
+
+struct ThreadUsage
+{
+	double usage = 0.0;
+	double time_ms = 0.0;
+};
+
+// Owned by the GS thread.
+static Threading::ThreadHandle s_gs_thread;
+static u64 s_last_perfmon_frame = 0;
+static Common::Timer::Value s_last_frame_time = 0;
+static u64 s_last_gs_cpu_time = 0;
+static std::array<double, GSPerfMon::CounterLast> s_last_counters = {};
+static std::vector<FrameStats> s_frames;
+static u32 s_metrics_samples = 0;
+static ThreadUsage s_gs_thread_usage;
+static std::vector<ThreadUsage> s_sw_thread_usage;
+
+void GSRunner::PrintCommandLineHelp(const char* progname)
+{
+	std::fprintf(stderr, "Usage: %s [parameters] [--] <dump file>\n", progname);
+	std::fprintf(stderr, "\n");
+	std::fprintf(stderr, "Replays a .gs/.gs.xz/.gs.zst dump without a window and writes per-frame timings as JSON.\n");
+	std::fprintf(stderr, "\n");
+	std::fprintf(stderr, "  -help: Displays this information and exits.\n");
+	std::fprintf(stderr, "  -renderer <sw|null>: Sets the GS renderer, defaults to sw.\n");
+	std::fprintf(stderr, "  -threads <count>: Sets the number of extra software rasterizer threads.\n");
+	std::fprintf(stderr, "  -loop <count>: Replays the dump <count> times, defaults to 1.\n");
+	std::fprintf(stderr, "  -start-frame <frame>: Starts the first replay at <frame>, for indexed .gs.zst dumps.\n"
+						 "    Frames from the preceding keyframe are replayed too, and included in the report.\n");
+	std::fprintf(stderr, "  -output <file>: Writes the JSON report to <file> instead of stdout.\n");
+	std::fprintf(stderr, "  -pack-textures <dir>: Packs the replacements in a game texture directory into\n"
+						 "    replacements.pack, instead of replaying a dump.\n");
+	std::fprintf(stderr, "  -bench-swizzle <iterations>: Times the GS block swizzle kernels of the selected\n"
+						 "    vector ISA (OVERRIDE_VECTOR_ISA) instead of replaying a dump.\n");
+	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
+						 "    parameters make up the filename.\n");
+	std::fprintf(stderr, "\n");
+}
+
+bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& params)
+{
+	bool no_more_args = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!no_more_args)
+		{
+#define CHECK_ARG(str) !std::strcmp(argv[i], str)
+#define CHECK_ARG_PARAM(str) (!std::strcmp(argv[i], str) && ((i + 1) < argc))
+
+			if (CHECK_ARG("-help"))
+			{
+				PrintCommandLineHelp(argv[0]);
+				return false;
+			}
+			else if (CHECK_ARG_PARAM("-renderer"))
+			{
+				const char* str = argv[++i];
+				if (StringUtil::Strcasecmp(str, "sw") == 0)
+					s_renderer = GSRendererType::SW;
+				else if (StringUtil::Strcasecmp(str, "null") == 0)
+					s_renderer = GSRendererType::Null;
+				else
+				{
+					Console.Error("Unknown renderer '%s', expected sw or null.", str);
+					return false;
+				}
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-threads"))
+			{
+				const std::optional<u32> threads = StringUtil::FromChars<u32>(argv[++i]);
+				if (!threads.has_value())
+				{
+					Console.Error("Invalid thread count '%s'.", argv[i]);
+					return false;
+				}
+				s_sw_threads = threads;
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-loop"))
+			{
+				s_loop_count = std::max(StringUtil::FromChars<s32>(argv[++i]).value_or(1), 1);
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-start-frame"))
+			{
+				s_start_frame = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-output"))
+			{
+				s_output_path = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-pack-textures"))
+			{
+				s_pack_textures_dir = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-bench-swizzle"))
+			{
+				s_bench_swizzle_iterations = std::max(StringUtil::FromChars<u32>(argv[++i]).value_or(1), 1u);
+				continue;
+			}
+			else if (CHECK_ARG("--"))
+			{
+				no_more_args = true;
+				continue;
+			}
+			else if (argv[i][0] == '-')
+			{
+				Console.Error("Unknown parameter: '%s'", argv[i]);
+				return false;
+			}
+
+#undef CHECK_ARG
+#undef CHECK_ARG_PARAM
+		}
+
+		if (!params.filename.empty())
+			params.filename += ' ';
+		params.filename += argv[i];
+	}
+
+	if (!s_pack_textures_dir.empty() || s_bench_swizzle_iterations > 0)
+		return true;
+
+	if (params.filename.empty())
+	{
+		PrintCommandLineHelp(argv[0]);
+		return false;
+	}
+
+	if (!VMManager::IsGSDumpFileName(params.filename))
+	{
+		Console.Error("'%s' is not a GS dump.", params.filename.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool GSRunner::InitializeConfig()
+{
+	EmuFolders::SetAppRoot();
+	if (!EmuFolders::SetResourcesDirectory())
+		Console.Warning("Resources directory is missing, OSD fonts will not be available.");
+
+	Error error;
+	if (!EmuFolders::SetDataDirectory(&error))
+	{
+		Console.Error("Failed to set data directory: %s", error.GetDescription().c_str());
+		return false;
+	}
+
+	// don't provide an ini path, or bother loading. we'll store everything in memory.
+	MemorySettingsInterface& si = s_settings_interface;
+	Host::Internal::SetBaseSettingsLayer(&si);
+
+	VMManager::SetDefaultSettings(si, true, true, true, true, true);
+
+	// complete as quickly as possible, the report is what we're after
+	si.SetBoolValue("EmuCore/GS", "FrameLimitEnable", false);
+	si.SetIntValue("EmuCore/GS", "VsyncEnable", false);
+	si.SetIntValue("EmuCore/GS", "Renderer", static_cast<int>(s_renderer));
+	if (s_sw_threads.has_value())
+		si.SetIntValue("EmuCore/GS", "extrathreads", static_cast<int>(s_sw_threads.value()));
+
+	// nothing is displayed, so don't pay for the OSD
+	si.SetBoolValue("EmuCore/GS", "OsdShowFPS", false);
+	si.SetBoolValue("EmuCore/GS", "OsdShowResolution", false);
+	si.SetBoolValue("EmuCore/GS", "OsdShowGSStats", false);
+
+	// ensure all input sources are disabled, we're not using them
+	si.SetBoolValue("InputSources", "SDL", false);
+	si.SetBoolValue("InputSources", "XInput", false);
+
+	// we don't need any sound output
+	si.SetStringValue("SPU2/Output", "OutputModule", "nullout");
+
+	// none of the bindings are going to resolve to anything
+	Pad::ClearPortBindings(si, 0);
+	si.ClearSection("Hotkeys");
+
+	// remove memory cards, so we don't have sharing violations
+	for (u32 i = 0; i < 2; i++)
+	{
+		si.SetBoolValue("MemoryCards", fmt::format("Slot{}_Enable", i + 1).c_str(), false);
+		si.SetStringValue("MemoryCards", fmt::format("Slot{}_Filename", i + 1).c_str(), "");
+	}
+
+	// the console log would end up interleaved with the report, unless it goes to a file
+	si.SetBoolValue("Logging", "EnableSystemConsole", !s_output_path.empty());
+	si.SetBoolValue("Logging", "EnableVerbose", false);
+
+	VMManager::Internal::LoadStartupSettings();
+	return true;
+}
+
+bool GSRunner::SeekToStartFrame()
+{
+	// Only indexed dumps know their frame count, the others fail in SeekToFrame().
+	const u32 frame_count = GSDumpReplayer::GetFrameCount();
+	if (frame_count > 0 && s_start_frame >= frame_count)
+	{
+		Console.ErrorFmt("Start frame {} is past the end of the dump ({} frames).", s_start_frame, frame_count);
+		return false;
+	}
+
+	return GSDumpReplayer::SeekToFrame(s_start_frame);
+}
+
+void GSRunner::RunVM(const VMBootParameters& params)
+{
+	if (!VMManager::Internal::CPUThreadInitialize())
+	{
+		VMManager::Internal::CPUThreadShutdown();
+		return;
+	}
+
+	VMManager::ApplySettings();
+	GSDumpReplayer::SetIsDumpRunner(true);
+
+	if (VMManager::Initialize(params))
+	{
+		// run until the requested number of loops is done
+		GSDumpReplayer::SetLoopCount(s_loop_count);
+
+		if (s_start_frame == 0 || SeekToStartFrame())
+		{
+			VMManager::SetState(VMState::Running);
+
+			for (;;)
+			{
+				const VMState state = VMManager::GetState();
+				if (state == VMState::Stopping || state == VMState::Shutdown)
+					break;
+				else if (state == VMState::Running)
+					VMManager::Execute();
+				else
+					Threading::Sleep(10);
+			}
+		}
+
+		VMManager::Shutdown(false);
+	}
+
+	VMManager::Internal::CPUThreadShutdown();
+}
+
+static std::string EscapeJSONString(const std::string_view str)
+{
+	std::string ret;
+	ret.reserve(str.size());
+
+	for (const char ch : str)
+	{
+		switch (ch)
+		{
+			case '"':
+				ret += "\\\"";
+				break;
+			case '\\':
+				ret += "\\\\";
+				break;
+			case '\n':
+				ret += "\\n";
+				break;
+			case '\t':
+				ret += "\\t";
+				break;
+			default:
+				if (static_cast<unsigned char>(ch) < 0x20)
+					fmt::format_to(std::back_inserter(ret), "\\u{:04x}", static_cast<unsigned>(ch));
+				else
+					ret += ch;
+				break;
+		}
+	}
+
+	return ret;
+}
+
+bool GSRunner::WriteReport(const std::string& dump_path)
+{
+	std::string out;
+	out.reserve(256 + s_frames.size() * 256);
+
+	std::array<double, GSPerfMon::CounterLast> totals = {};
+	double total_wall_ms = 0.0;
+	double total_gs_cpu_ms = 0.0;
+	double min_gs_cpu_ms = s_frames.empty() ? 0.0 : s_frames.front().gs_cpu_ms;
+	double max_gs_cpu_ms = 0.0;
+
+	fmt::format_to(std::back_inserter(out), "{{\n\t\"dump\": \"{}\",\n\t\"renderer\": \"{}\",\n\t\"loops\": {},\n\t\"frames\": [\n",
+		EscapeJSONString(dump_path), (s_renderer == GSRendererType::SW) ? "sw" : "null", s_loop_count);
+
+	for (size_t i = 0; i < s_frames.size(); i++)
+	{
+		const FrameStats& fs = s_frames[i];
+		fmt::format_to(std::back_inserter(out), "\t\t{{\"frame\": {}, \"wall_ms\": {:.4f}, \"gs_cpu_ms\": {:.4f}",
+			fs.frame, fs.wall_ms, fs.gs_cpu_ms);
+		for (size_t c = 0; c < fs.counters.size(); c++)
+		{
+			fmt::format_to(std::back_inserter(out), ", \"{}\": {}", s_counter_names[c], fs.counters[c]);
+			totals[c] += fs.counters[c];
+		}
+		out += (i + 1) < s_frames.size() ? "},\n" : "}\n";
+
+		total_wall_ms += fs.wall_ms;
+		total_gs_cpu_ms += fs.gs_cpu_ms;
+		min_gs_cpu_ms = std::min(min_gs_cpu_ms, fs.gs_cpu_ms);
+		max_gs_cpu_ms = std::max(max_gs_cpu_ms, fs.gs_cpu_ms);
+	}
+
+	const double frame_count = static_cast<double>(std::max<size_t>(s_frames.size(), 1));
+	const double samples = static_cast<double>(std::max<u32>(s_metrics_samples, 1));
+
+	fmt::format_to(std::back_inserter(out),
+		"\t],\n\t\"summary\": {{\n\t\t\"frames\": {},\n\t\t\"wall_ms\": {:.4f},\n\t\t\"gs_cpu_ms\": {:.4f},\n"
+		"\t\t\"gs_cpu_ms_avg\": {:.4f},\n\t\t\"gs_cpu_ms_min\": {:.4f},\n\t\t\"gs_cpu_ms_max\": {:.4f},\n"
+		"\t\t\"gs_thread_usage\": {:.2f},\n",
+		s_frames.size(), total_wall_ms, total_gs_cpu_ms, total_gs_cpu_ms / frame_count, min_gs_cpu_ms, max_gs_cpu_ms,
+		s_gs_thread_usage.usage / samples);
+
+	for (size_t c = 0; c < totals.size(); c++)
+		fmt::format_to(std::back_inserter(out), "\t\t\"{}\": {},\n", s_counter_names[c], totals[c]);
+
+	out += "\t\t\"sw_threads\": [";
+	for (size_t i = 0; i < s_sw_thread_usage.size(); i++)
+	{
+		fmt::format_to(std::back_inserter(out), "{}{{\"usage\": {:.2f}, \"time_ms\": {:.4f}}}", (i > 0) ? ", " : "",
+			s_sw_thread_usage[i].usage / samples, s_sw_thread_usage[i].time_ms / samples);
+	}
+	out += "]\n\t}\n}\n";
+
+	if (s_output_path.empty())
+	{
+		std::fwrite(out.data(), 1, out.size(), stdout);
+		std::fflush(stdout);
+		return true;
+	}
+
+	if (!FileSystem::WriteStringToFile(s_output_path.c_str(), out))
+	{
+		Console.Error("Failed to write report to '%s'.", s_output_path.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	VMBootParameters params;
+	if (!GSRunner::ParseCommandLineArgs(argc, argv, params))
+		return EXIT_FAILURE;
+
+	if (!s_pack_textures_dir.empty())
+	{
+		Log::SetConsoleOutputLevel(LOGLEVEL_INFO);
+
+		Error error;
+		if (!GSTextureReplacements::BuildReplacementPack(s_pack_textures_dir, &error))
+		{
+			Console.Error("Failed to pack textures: %s", error.GetDescription().c_str());
+			return EXIT_FAILURE;
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+	if (s_bench_swizzle_iterations > 0)
+	{
+		// Each iteration writes and reads back 32 blocks at every bit depth.
+		const u64 ticks = MULTI_ISA_SELECT(GSBenchmarkSwizzle)(s_bench_swizzle_iterations);
+		const double seconds = Common::Timer::ConvertValueToSeconds(ticks);
+		const double megabytes = static_cast<double>(s_bench_swizzle_iterations) * 32 * 256 * 8 / (1024.0 * 1024.0);
+		std::printf("{\"swizzle_ms\": %.3f, \"swizzle_mb_per_sec\": %.1f}\n", seconds * 1000.0, megabytes / seconds);
+		return EXIT_SUCCESS;
+	}
+
+	if (!GSRunner::InitializeConfig())
+		return EXIT_FAILURE;
+
+	GSRunner::RunVM(params);
+
+	if (s_frames.empty())
+	{
+		Console.Error("No frames were replayed from '%s'.", params.filename.c_str());
+		return EXIT_FAILURE;
+	}
+
+	return GSRunner::WriteReport(params.filename) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Host implementations
+//////////////////////////////////////////////////////////////////////////
+
+std::optional<WindowInfo> Host::AcquireRenderWindow(bool recreate_window)
+{
+	// The SW renderer still uploads its output to a device texture, present to nothing.
+	WindowInfo wi;
+	wi.type = WindowInfo::Type::Surfaceless;
+	wi.surface_width = 640;
+	wi.surface_height = 480;
+	wi.surface_scale = 1.0f;
+	return wi;
+}
+
+void Host::ReleaseRenderWindow()
+{
+}
+
+void Host::BeginPresentFrame()
+{
+	// Frames which were skipped by the renderer don't advance the perfmon frame.
+	const u64 frame = g_perfmon.GetFrame();
+	if (frame == s_last_perfmon_frame)
+		return;
+
+	const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+	if (!s_gs_thread)
+	{
+		s_gs_thread = Threading::ThreadHandle::GetForCallingThread();
+		s_last_gs_cpu_time = s_gs_thread.GetCPUTime();
+		s_last_frame_time = now;
+		s_last_perfmon_frame = frame;
+		for (size_t i = 0; i < s_last_counters.size(); i++)
+			s_last_counters[i] = g_perfmon.GetCounter(static_cast<GSPerfMon::counter_t>(i));
+		return;
+	}
+
+	FrameStats& fs = s_frames.emplace_back();
+	fs.frame = s_frames.size();
+
+	fs.wall_ms = Common::Timer::ConvertValueToMilliseconds(now - s_last_frame_time);
+	s_last_frame_time = now;
+
+	const u64 cpu_time = s_gs_thread.GetCPUTime();
+	fs.gs_cpu_ms = static_cast<double>(cpu_time - s_last_gs_cpu_time) * 1000.0 /
+				   static_cast<double>(Threading::GetThreadTicksPerSecond());
+	s_last_gs_cpu_time = cpu_time;
+
+	for (size_t i = 0; i < s_last_counters.size(); i++)
+	{
+		// perfmon resets every 32 frames to zero
+		const double val = g_perfmon.GetCounter(static_cast<GSPerfMon::counter_t>(i));
+		fs.counters[i] = (val < s_last_counters[i]) ? val : (val - s_last_counters[i]);
+		s_last_counters[i] = val;
+	}
+
+	s_last_perfmon_frame = frame;
+}
+
+void Host::OnPerformanceMetricsUpdated()
+{
+	s_metrics_samples++;
+	s_gs_thread_usage.usage += PerformanceMetrics::GetGSThreadUsage();
+	s_gs_thread_usage.time_ms += PerformanceMetrics::GetGSThreadAverageTime();
+
+	const u32 sw_threads = PerformanceMetrics::GetGSSWThreadCount();
+	if (s_sw_thread_usage.size() < sw_threads)
+		s_sw_thread_usage.resize(sw_threads);
+	for (u32 i = 0; i < sw_threads; i++)
+	{
+		s_sw_thread_usage[i].usage += PerformanceMetrics::GetGSSWThreadUsage(i);
+		s_sw_thread_usage[i].time_ms += PerformanceMetrics::GetGSSWThreadAverageTime(i);
+	}
+}
+
+void Host::OnGameChanged(const std::string& title, const std::string& elf_override, const std::string& disc_path,
+	const std::string& disc_serial, u32 disc_crc, u32 current_crc)
+{
+}
+
+void Host::PumpMessagesOnCPUThread()
+{
+}
+
+int FileSystem::OpenFDFileContent(const char* filename)
+{
+	// content:// URIs only exist on Android.
+	return -1;
+}
+
+void Host::CommitBaseSettingChanges()
+{
+	// nothing to save, we're all in memory
+}
+
+void Host::LoadSettings(SettingsInterface& si, std::unique_lock<std::mutex>& lock)
+{
+}
+
+void Host::CheckForSettingsChanges(const Pcsx2Config& old_config)
+{
+}
+
+bool Host::RequestResetSettings(bool folders, bool core, bool controllers, bool hotkeys, bool ui)
+{
+	// not running any UI, so no settings requests will come in
+	return false;
+}
+
+void Host::SetDefaultUISettings(SettingsInterface& si)
+{
+	// nothing
+}
+
+std::unique_ptr<ProgressCallback> Host::CreateHostProgressCallback()
+{
+	return ProgressCallback::CreateNullProgressCallback();
+}
+
+void Host::ReportErrorAsync(const std::string_view title, const std::string_view message)
+{
+	if (!title.empty() && !message.empty())
+		ERROR_LOG("ReportErrorAsync: {}: {}", title, message);
+	else if (!message.empty())
+		ERROR_LOG("ReportErrorAsync: {}", message);
+}
+
+bool Host::ConfirmMessage(const std::string_view title, const std::string_view message)
+{
+	if (!title.empty() && !message.empty())
+		ERROR_LOG("ConfirmMessage: {}: {}", title, message);
+	else if (!message.empty())
+		ERROR_LOG("ConfirmMessage: {}", message);
+
+	return true;
+}
+
+void Host::OpenURL(const std::string_view url)
+{
+	// noop
+}
+
+bool Host::CopyTextToClipboard(const std::string_view text)
+{
+	return false;
+}
+
+void Host::BeginTextInput()
+{
+	// noop
+}
+
+void Host::EndTextInput()
+{
+	// noop
+}
+
+std::optional<WindowInfo> Host::GetTopLevelWindowInfo()
+{
+	return std::nullopt;
+}
+
+void Host::OnInputDeviceConnected(const std::string_view identifier, const std::string_view device_name)
+{
+}
+
+void Host::OnInputDeviceDisconnected(const InputBindingKey key, const std::string_view identifier)
+{
+}
+
+void Host::SetMouseMode(bool relative_mode, bool hide_cursor)
+{
+}
+
+void Host::RequestResizeHostDisplay(s32 width, s32 height)
+{
+}
+
+void Host::OnVMStarting()
+{
+}
+
+void Host::OnVMStarted()
+{
+}
+
+void Host::OnVMDestroyed()
+{
+}
+
+void Host::OnVMPaused()
+{
+}
+
+void Host::OnVMResumed()
+{
+}
+
+void Host::OnSaveStateLoading(const std::string_view filename)
+{
+}
+
+void Host::OnSaveStateLoaded(const std::string_view filename, bool was_successful)
+{
+}
+
+void Host::OnSaveStateSaved(const std::string_view filename)
+{
+}
+
+void Host::RunOnCPUThread(std::function<void()> function, bool block /* = false */)
+{
+	pxFailRel("Not implemented");
+}
+
+void Host::RefreshGameListAsync(bool invalidate_cache)
+{
+}
+
+void Host::CancelGameListRefresh()
+{
+}
+
+bool Host::IsFullscreen()
+{
+	return false;
+}
+
+void Host::SetFullscreen(bool enabled)
+{
+}
+
+void Host::OnCaptureStarted(const std::string& filename)
+{
+}
+
+void Host::OnCaptureStopped()
+{
+}
+
+void Host::RequestExitApplication(bool allow_confirm)
+{
+}
+
+void Host::RequestExitBigPicture()
+{
+}
+
+void Host::RequestVMShutdown(bool allow_confirm, bool allow_save_state, bool default_save_state)
+{
+	VMManager::SetState(VMState::Stopping);
+}
+
+void Host::OnAchievementsLoginSuccess(const char* username, u32 points, u32 sc_points, u32 unread_messages)
+{
+	// noop
+}
+
+void Host::OnAchievementsLoginRequested(Achievements::LoginRequestReason reason)
+{
+	// noop
+}
+
+void Host::OnAchievementsHardcoreModeChanged(bool enabled)
+{
+	// noop
+}
+
+void Host::OnAchievementsRefreshed()
+{
+	// noop
+}
+
+void Host::OnCoverDownloaderOpenRequested()
+{
+	// noop
+}
+
+void Host::OnCreateMemoryCardOpenRequested()
+{
+	// noop
+}
+
+bool Host::ShouldPreferHostFileSelector()
+{
+	return false;
+}
+
+void Host::OpenHostFileSelectorAsync(std::string_view title, bool select_directory, FileSelectorCallback callback,
+	FileSelectorFilters filters, std::string_view initial_directory)
+{
+	callback(std::string());
+}
+
+std::optional<u32> InputManager::ConvertHostKeyboardStringToCode(const std::string_view str)
+{
+	return std::nullopt;
+}
+
+std::optional<std::string> InputManager::ConvertHostKeyboardCodeToString(u32 code)
+{
+	return std::nullopt;
+}
+
+const char* InputManager::ConvertHostKeyboardCodeToIcon(u32 code)
+{
+	return nullptr;
+}
+
+s32 Host::Internal::GetTranslatedStringImpl(
+	const std::string_view context, const std::string_view msg, char* tbuf, size_t tbuf_space)
+{
+	if (msg.size() > tbuf_space)
+		return -1;
+	else if (msg.empty())
+		return 0;
+
+	std::memcpy(tbuf, msg.data(), msg.size());
+	return static_cast<s32>(msg.size());
+}
+
+std::string Host::TranslatePluralToString(const char* context, const char* msg, const char* disambiguation, int count)
+{
+	TinyString count_str = TinyString::from_format("{}", count);
+
+	std::string ret(msg);
+	for (;;)
+	{
+		std::string::size_type pos = ret.find("%n");
+		if (pos == std::string::npos)
+			break;
+
+		ret.replace(pos, 2, count_str.view());
+	}
+
+	return ret;
+}
+
+void Host::ReportInfoAsync(const std::string_view title, const std::string_view message)
+{
+}
+
+bool Host::LocaleCircleConfirm()
+{
+	return false;
+}
+
+bool Host::InNoGUIMode()
+{
+	return true;
+}
@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/CDVD/ZstdSeekable.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/StringUtil.h"
+#include "common/Timer.h"
+
+#include "fmt/format.h"
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Converts flat disc images to the zstd seekable format read by ZstdFileReader. Frames are compressed
+// independently, so they're spread over worker threads in batches and written back in order.
+namespace IsoConv
+{
+	struct Options
+	{
+		std::string input;
+		std::string output;
+		int level = 19;
+		u32 frame_size = ZstdSeekable::DEFAULT_FRAME_SIZE;
+		u32 threads = 0;
+	};
+
+	struct Worker
+	{
+		ZSTD_CCtx* cctx = nullptr;
+		bool failed = false;
+	};
+
+	/// Frames compressed per worker and batch, enough to keep every thread busy between writes.
+	static constexpr u32 FRAMES_PER_THREAD = 8;
+
+	static void PrintCommandLineHelp(const char* progname);
+	static bool ParseCommandLineArgs(int argc, char* argv[], Options& opts);
+	static bool Convert(const Options& opts, Error* error);
+} // namespace IsoConv
+
+void IsoConv::PrintCommandLineHelp(const char* progname)
+{
+	std::fprintf(stderr, "Usage: %s [parameters] [--] <input image> <output image>\n", progname);
+	std::fprintf(stderr, "\n");
+	std::fprintf(stderr, "Compresses an uncompressed .iso/.bin image into a zstd seekable image (.iso.zst).\n");
+	std::fprintf(stderr, "\n");
+	std::fprintf(stderr, "  -help: Displays this information and exits.\n");
+	std::fprintf(stderr, "  -level <1-22>: Sets the zstd compression level, defaults to 19.\n");
+	std::fprintf(stderr, "  -frame-size <KiB>: Sets the amount of data per independently decodable frame,\n"
+						 "    a multiple of 2 KiB up to 4096 KiB, defaults to %u.\n", ZstdSeekable::DEFAULT_FRAME_SIZE / 1024);
+	std::fprintf(stderr, "  -threads <count>: Sets the number of compression threads, defaults to one per CPU.\n");
+	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
+						 "    parameters make up the filenames.\n");
+	std::fprintf(stderr, "\n");
+}
+
+bool IsoConv::ParseCommandLineArgs(int argc, char* argv[], Options& opts)
+{
+	std::vector<std::string> files;
+	bool no_more_args = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!no_more_args)
+		{
+#define CHECK_ARG(str) !std::strcmp(argv[i], str)
+#define CHECK_ARG_PARAM(str) (!std::strcmp(argv[i], str) && ((i + 1) < argc))
+
+			if (CHECK_ARG("-help"))
+			{
+				PrintCommandLineHelp(argv[0]);
+				return false;
+			}
+			else if (CHECK_ARG_PARAM("-level"))
+			{
+				const std::optional<int> level = StringUtil::FromChars<int>(argv[++i]);
+				if (!level.has_value() || level.value() < 1 || level.value() > ZSTD_maxCLevel())
+				{
+					Console.Error("Invalid compression level '%s'.", argv[i]);
+					return false;
+				}
+				opts.level = level.value();
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-frame-size"))
+			{
+				const std::optional<u32> kib = StringUtil::FromChars<u32>(argv[++i]);
+				if (!kib.has_value() || kib.value() == 0 || (kib.value() % 2) != 0 ||
+					kib.value() > ZstdSeekable::MAX_FRAME_SIZE / 1024)
+				{
+					Console.Error("Invalid frame size '%s'.", argv[i]);
+					return false;
+				}
+				opts.frame_size = kib.value() * 1024;
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-threads"))
+			{
+				const std::optional<u32> threads = StringUtil::FromChars<u32>(argv[++i]);
+				if (!threads.has_value() || threads.value() == 0)
+				{
+					Console.Error("Invalid thread count '%s'.", argv[i]);
+					return false;
+				}
+				opts.threads = threads.value();
+				continue;
+			}
+			else if (CHECK_ARG("--"))
+			{
+				no_more_args = true;
+				continue;
+			}
+			else if (argv[i][0] == '-')
+			{
+				Console.Error("Unknown parameter: '%s'", argv[i]);
+				return false;
+			}
+
+#undef CHECK_ARG
+#undef CHECK_ARG_PARAM
+		}
+
+		files.emplace_back(argv[i]);
+	}
+
+	if (files.size() != 2)
+	{
+		PrintCommandLineHelp(argv[0]);
+		return false;
+	}
+
+	opts.input = std::move(files[0]);
+	opts.output = std::move(files[1]);
+	if (opts.threads == 0)
+		opts.threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	return true;
+}
+
+bool IsoConv::Convert(const Options& opts, Error* error)
+{
+	using namespace ZstdSeekable;
+
+	FileSystem::ManagedCFilePtr in = FileSystem::OpenManagedCFile(opts.input.c_str(), "rb", error);
+	if (!in)
+		return false;
+
+	const s64 input_size = FileSystem::FSize64(in.get());
+	if (input_size <= 0)
+	{
+		Error::SetString(error, "Failed to determine input size.");
+		return false;
+	}
+
+	const u64 num_frames = (static_cast<u64>(input_size) + opts.frame_size - 1) / opts.frame_size;
+	if (num_frames > MAX_FRAMES)
+	{
+		Error::SetString(error, "Input is too large for this frame size, use a larger -frame-size.");
+		return false;
+	}
+
+	FileSystem::ManagedCFilePtr out = FileSystem::OpenManagedCFile(opts.output.c_str(), "wb", error);
+	if (!out)
+		return false;
+
+	std::vector<Worker> workers(opts.threads);
+	for (Worker& worker : workers)
+	{
+		worker.cctx = ZSTD_createCCtx();
+		if (!worker.cctx)
+		{
+			Error::SetString(error, "Failed to create zstd compression context.");
+			return false;
+		}
+
+		ZSTD_CCtx_setParameter(worker.cctx, ZSTD_c_compressionLevel, opts.level);
+		ZSTD_CCtx_setParameter(worker.cctx, ZSTD_c_checksumFlag, 1);
+		ZSTD_CCtx_setParameter(worker.cctx, ZSTD_c_contentSizeFlag, 1);
+	}
+
+	const u32 batch_frames = opts.threads * FRAMES_PER_THREAD;
+	const size_t bound = ZSTD_compressBound(opts.frame_size);
+	auto in_buf = std::make_unique_for_overwrite<u8[]>(static_cast<size_t>(batch_frames) * opts.frame_size);
+	auto out_buf = std::make_unique_for_overwrite<u8[]>(static_cast<size_t>(batch_frames) * bound);
+	std::vector<Entry> entries;
+	entries.reserve(static_cast<size_t>(num_frames));
+
+	Console.WriteLn(fmt::format("Compressing '{}' ({} frames of {} KiB) at level {} on {} threads...", opts.input,
+		num_frames, opts.frame_size / 1024, opts.level, opts.threads));
+
+	const Common::Timer timer;
+	u64 input_done = 0;
+	u64 output_done = 0;
+	bool success = true;
+	while (success && input_done < static_cast<u64>(input_size))
+	{
+		const size_t batch_bytes = static_cast<size_t>(std::min<u64>(
+			static_cast<u64>(batch_frames) * opts.frame_size, static_cast<u64>(input_size) - input_done));
+		if (std::fread(in_buf.get(), batch_bytes, 1, in.get()) != 1)
+		{
+			Error::SetString(error, "Failed to read from input.");
+			success = false;
+			break;
+		}
+
+		const u32 count = static_cast<u32>((batch_bytes + opts.frame_size - 1) / opts.frame_size);
+		const size_t first_entry = entries.size();
+		entries.resize(first_entry + count);
+
+		std::atomic<u32> next_frame{0};
+		std::vector<std::thread> threads;
+		threads.reserve(workers.size());
+		for (Worker& worker : workers)
+		{
+			threads.emplace_back([&, &worker = worker]() {
+				for (u32 i = next_frame.fetch_add(1, std::memory_order_relaxed); i < count;
+					 i = next_frame.fetch_add(1, std::memory_order_relaxed))
+				{
+					const size_t src_size = std::min<size_t>(opts.frame_size, batch_bytes - static_cast<size_t>(i) * opts.frame_size);
+					const size_t res = ZSTD_compress2(worker.cctx, &out_buf[i * bound], bound,
+						&in_buf[static_cast<size_t>(i) * opts.frame_size], src_size);
+					if (ZSTD_isError(res))
+					{
+						worker.failed = true;
+						return;
+					}
+
+					entries[first_entry + i] = {static_cast<u32>(res), static_cast<u32>(src_size)};
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+			thread.join();
+
+		if (std::any_of(workers.begin(), workers.end(), [](const Worker& w) { return w.failed; }))
+		{
+			Error::SetString(error, "zstd compression failed.");
+			success = false;
+			break;
+		}
+
+		for (u32 i = 0; i < count; i++)
+		{
+			const u32 size = entries[first_entry + i].compressed_size;
+			if (std::fwrite(&out_buf[i * bound], size, 1, out.get()) != 1)
+			{
+				Error::SetString(error, "Failed to write to output.");
+				success = false;
+				break;
+			}
+			output_done += size;
+		}
+
+		input_done += batch_bytes;
+		std::fprintf(stderr, "\r%3u%% (%.1f MiB/s)", static_cast<u32>(input_done * 100 / static_cast<u64>(input_size)),
+			static_cast<double>(input_done) / 1048576.0 / std::max(timer.GetTimeSeconds(), 0.001));
+	}
+	std::fprintf(stderr, "\n");
+
+	for (Worker& worker : workers)
+		ZSTD_freeCCtx(worker.cctx);
+
+	if (success)
+	{
+		const SkippableHeader header = {SKIPPABLE_MAGIC, static_cast<u32>(entries.size() * sizeof(Entry) + sizeof(Footer))};
+		const Footer footer = {static_cast<u32>(entries.size()), 0, SEEKABLE_MAGIC};
+		if (std::fwrite(&header, sizeof(header), 1, out.get()) != 1 ||
+			std::fwrite(entries.data(), sizeof(Entry), entries.size(), out.get()) != entries.size() ||
+			std::fwrite(&footer, sizeof(footer), 1, out.get()) != 1 || std::fflush(out.get()) != 0)
+		{
+			Error::SetString(error, "Failed to write seek table.");
+			success = false;
+		}
+	}
+
+	out.reset();
+	if (!success)
+	{
+		FileSystem::DeleteFilePath(opts.output.c_str());
+		return false;
+	}
+
+	Console.WriteLn(fmt::format("Wrote '{}': {:.1f} MiB -> {:.1f} MiB ({:.1f}%) in {:.1f} seconds.", opts.output,
+		static_cast<double>(input_size) / 1048576.0, static_cast<double>(output_done) / 1048576.0,
+		100.0 * static_cast<double>(output_done) / static_cast<double>(input_size), timer.GetTimeSeconds()));
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	Log::SetConsoleOutputLevel(LOGLEVEL_INFO);
+
+	IsoConv::Options opts;
+	if (!IsoConv::ParseCommandLineArgs(argc, argv, opts))
+		return EXIT_FAILURE;
+
+	Error error;
+	if (!IsoConv::Convert(opts, &error))
+	{
+		Console.Error("Conversion failed: %s", error.GetDescription().c_str());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,326 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "CDVD/CDVDPrefetcher.h"
+#include "Config.h"
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Reads landing within this many sectors past the end of the current run still count as sequential,
+// games commonly skip over padding or a few sectors of subheader data.
+static constexpr u32 SEQUENTIAL_GAP = 16;
+
+// A transition has to be seen this many times before it's used for prefetching.
+static constexpr u32 MIN_CONFIDENCE = 2;
+
+// Prefetch size when the predicted extent's length isn't known yet, and the upper limit otherwise.
+static constexpr u32 DEFAULT_PREFETCH_SECTORS = 64;
+static constexpr u32 MAX_PREFETCH_SECTORS = 2048;
+
+// Keeps profiles of games which seek all over the disc from growing without bound.
+static constexpr size_t MAX_EXTENTS = 16384;
+
+static constexpr u32 PROFILE_MAGIC = 0x46504443; // CDPF
+static constexpr u32 PROFILE_VERSION = 1;
+
+namespace
+{
+	struct ProfileHeader
+	{
+		u32 magic;
+		u32 version;
+		u32 block_count;
+		u32 num_extents;
+	};
+	static_assert(sizeof(ProfileHeader) == 16);
+
+	struct ProfileEntry
+	{
+		u32 start;
+		u32 length;
+		u32 num_successors;
+		u32 successors[4][2];
+	};
+	static_assert(sizeof(ProfileEntry) == 44);
+} // namespace
+
+CDVDPrefetcher::CDVDPrefetcher() = default;
+
+CDVDPrefetcher::~CDVDPrefetcher()
+{
+	Close();
+}
+
+void CDVDPrefetcher::SetProfile(std::string serial, u32 block_count)
+{
+	if (serial == m_serial && block_count == m_block_count)
+		return;
+
+	Close();
+
+	m_serial = std::move(serial);
+	m_block_count = block_count;
+	if (!m_serial.empty())
+		Load();
+}
+
+void CDVDPrefetcher::Close()
+{
+	if (!m_serial.empty())
+	{
+		// Don't lose the extent which was being read when the disc went away.
+		if (m_has_run)
+			RecordLength(m_run_start, m_run_end - m_run_start);
+
+		ReportStats();
+		if (m_dirty)
+			Save();
+	}
+
+	m_serial = {};
+	m_block_count = 0;
+	m_extents.clear();
+	m_dirty = false;
+	m_has_run = false;
+	m_prediction = {};
+	m_last_read_was_seek = false;
+	m_last_read_was_hit = false;
+	m_seeks = 0;
+	m_predictions = 0;
+	m_hits = 0;
+	m_hit_waits = 0;
+	m_miss_waits = 0;
+	m_hit_wait_time = 0;
+	m_miss_wait_time = 0;
+}
+
+CDVDPrefetcher::Extent CDVDPrefetcher::OnRead(u32 lsn)
+{
+	if (m_serial.empty())
+		return {};
+
+	if (m_has_run && lsn >= m_run_start && lsn <= m_run_end + SEQUENTIAL_GAP)
+	{
+		m_run_end = std::max(m_run_end, lsn + 1);
+		m_last_read_was_seek = false;
+		return {};
+	}
+
+	m_seeks++;
+	m_last_read_was_seek = true;
+	m_last_read_was_hit = (m_prediction.count > 0 && lsn >= m_prediction.lsn && lsn - m_prediction.lsn < m_prediction.count);
+	m_hits += m_last_read_was_hit;
+	m_prediction = {};
+
+	if (m_has_run)
+	{
+		RecordLength(m_run_start, m_run_end - m_run_start);
+		RecordTransition(m_run_start, lsn);
+	}
+
+	m_run_start = lsn;
+	m_run_end = lsn + 1;
+	m_has_run = true;
+
+	const Extent next = Predict(lsn);
+	if (next.count > 0)
+	{
+		m_prediction = next;
+		m_predictions++;
+	}
+
+	return next;
+}
+
+void CDVDPrefetcher::OnReadFinished(Common::Timer::Value wait_time)
+{
+	// Only seeks are interesting, sequential reads are served by the reader's own readahead.
+	if (m_serial.empty() || !m_last_read_was_seek)
+		return;
+
+	if (m_last_read_was_hit)
+	{
+		m_hit_waits++;
+		m_hit_wait_time += wait_time;
+	}
+	else
+	{
+		m_miss_waits++;
+		m_miss_wait_time += wait_time;
+	}
+
+	m_last_read_was_seek = false;
+}
+
+void CDVDPrefetcher::RecordTransition(u32 from, u32 to)
+{
+	auto it = m_extents.find(from);
+	if (it == m_extents.end())
+	{
+		if (m_extents.size() >= MAX_EXTENTS)
+			return;
+		it = m_extents.emplace(from, ExtentInfo()).first;
+	}
+
+	ExtentInfo& info = it->second;
+	m_dirty = true;
+
+	for (u32 i = 0; i < info.num_successors; i++)
+	{
+		if (info.successors[i].lsn == to)
+		{
+			info.successors[i].count = std::min(info.successors[i].count + 1, 0xFFFFu);
+			return;
+		}
+	}
+
+	if (info.num_successors < MAX_SUCCESSORS)
+	{
+		info.successors[info.num_successors++] = {to, 1};
+		return;
+	}
+
+	// Replace the least used successor, so a pattern which changed between versions of a game is relearned.
+	Successor* victim = std::min_element(std::begin(info.successors), std::end(info.successors),
+		[](const Successor& lhs, const Successor& rhs) { return lhs.count < rhs.count; });
+	*victim = {to, 1};
+}
+
+void CDVDPrefetcher::RecordLength(u32 start, u32 length)
+{
+	auto it = m_extents.find(start);
+	if (it == m_extents.end())
+	{
+		if (m_extents.size() >= MAX_EXTENTS)
+			return;
+		it = m_extents.emplace(start, ExtentInfo()).first;
+	}
+
+	if (length > it->second.length)
+	{
+		it->second.length = length;
+		m_dirty = true;
+	}
+}
+
+CDVDPrefetcher::Extent CDVDPrefetcher::Predict(u32 lsn) const
+{
+	const auto it = m_extents.find(lsn);
+	if (it == m_extents.end() || it->second.num_successors == 0)
+		return {};
+
+	const ExtentInfo& info = it->second;
+	const Successor* best = std::max_element(info.successors, info.successors + info.num_successors,
+		[](const Successor& lhs, const Successor& rhs) { return lhs.count < rhs.count; });
+	if (best->count < MIN_CONFIDENCE || best->lsn >= m_block_count)
+		return {};
+
+	const auto next = m_extents.find(best->lsn);
+	u32 count = (next != m_extents.end() && next->second.length > 0) ? next->second.length : DEFAULT_PREFETCH_SECTORS;
+	count = std::min({count, MAX_PREFETCH_SECTORS, m_block_count - best->lsn});
+	return {best->lsn, count};
+}
+
+std::string CDVDPrefetcher::GetProfilePath() const
+{
+	return Path::Combine(EmuFolders::Cache,
+		Path::Combine("cdvd_profiles", fmt::format("{}.bin", Path::SanitizeFileName(m_serial))));
+}
+
+void CDVDPrefetcher::Load()
+{
+	const std::string path = GetProfilePath();
+	const std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(path.c_str());
+	if (!data.has_value())
+		return;
+
+	ProfileHeader header;
+	if (data->size() < sizeof(header))
+		return;
+
+	std::memcpy(&header, data->data(), sizeof(header));
+	if (header.magic != PROFILE_MAGIC || header.version != PROFILE_VERSION ||
+		data->size() != sizeof(header) + static_cast<size_t>(header.num_extents) * sizeof(ProfileEntry))
+	{
+		Console.Warning(fmt::format("CDVD: Ignoring invalid seek profile '{}'.", Path::GetFileName(path)));
+		return;
+	}
+
+	// A different dump of the same game, the sector layout can't be trusted.
+	if (header.block_count != m_block_count)
+	{
+		DevCon.WriteLn(fmt::format("CDVD: Seek profile for {} is for a different image, relearning.", m_serial));
+		return;
+	}
+
+	const u32 num_extents = std::min<u32>(header.num_extents, MAX_EXTENTS);
+	m_extents.reserve(num_extents);
+	for (u32 i = 0; i < num_extents; i++)
+	{
+		ProfileEntry entry;
+		std::memcpy(&entry, data->data() + sizeof(header) + i * sizeof(entry), sizeof(entry));
+
+		ExtentInfo& info = m_extents[entry.start];
+		info.length = entry.length;
+		info.num_successors = std::min(entry.num_successors, MAX_SUCCESSORS);
+		for (u32 j = 0; j < info.num_successors; j++)
+			info.successors[j] = {entry.successors[j][0], entry.successors[j][1]};
+	}
+
+	DevCon.WriteLn(fmt::format("CDVD: Loaded seek profile for {} with {} extents.", m_serial, m_extents.size()));
+}
+
+void CDVDPrefetcher::Save()
+{
+	static_assert(std::size(ProfileEntry{}.successors) == MAX_SUCCESSORS);
+
+	const std::string path = GetProfilePath();
+	if (!FileSystem::EnsureDirectoryExists(std::string(Path::GetDirectory(path)).c_str(), false))
+		return;
+
+	std::vector<u8> data(sizeof(ProfileHeader) + m_extents.size() * sizeof(ProfileEntry));
+	const ProfileHeader header = {PROFILE_MAGIC, PROFILE_VERSION, m_block_count, static_cast<u32>(m_extents.size())};
+	std::memcpy(data.data(), &header, sizeof(header));
+
+	u8* ptr = data.data() + sizeof(header);
+	for (const auto& [start, info] : m_extents)
+	{
+		ProfileEntry entry = {};
+		entry.start = start;
+		entry.length = info.length;
+		entry.num_successors = info.num_successors;
+		for (u32 j = 0; j < info.num_successors; j++)
+		{
+			entry.successors[j][0] = info.successors[j].lsn;
+			entry.successors[j][1] = info.successors[j].count;
+		}
+		std::memcpy(ptr, &entry, sizeof(entry));
+		ptr += sizeof(entry);
+	}
+
+	if (!FileSystem::WriteBinaryFile(path.c_str(), data.data(), data.size()))
+		Console.Warning(fmt::format("CDVD: Failed to save seek profile '{}'.", Path::GetFileName(path)));
+}
+
+void CDVDPrefetcher::ReportStats() const
+{
+	if (m_seeks == 0)
+		return;
+
+	const double hit_wait = m_hit_waits ? Common::Timer::ConvertValueToMilliseconds(m_hit_wait_time) / m_hit_waits : 0.0;
+	const double miss_wait = m_miss_waits ? Common::Timer::ConvertValueToMilliseconds(m_miss_wait_time) / m_miss_waits : 0.0;
+	const double saved = (m_hit_waits && m_miss_waits) ? std::max(miss_wait - hit_wait, 0.0) * m_hits : 0.0;
+
+	Console.WriteLn(fmt::format("CDVD: Seek prefetch for {}: {} seeks, {} predicted, {} hits ({:.1f}%), "
+								"{:.2f} ms average wait on hits vs {:.2f} ms otherwise, ~{:.0f} ms saved.",
+		m_serial, m_seeks, m_predictions, m_hits, m_predictions ? (100.0 * m_hits / m_predictions) : 0.0,
+		hit_wait, miss_wait, saved));
+}
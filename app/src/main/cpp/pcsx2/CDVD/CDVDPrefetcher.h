@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+#include "common/Timer.h"
+
+#include <string>
+#include <unordered_map>
+
+/// Learns which extent a game seeks to after reading another one, and predicts the next seek target.
+/// Reads are grouped into extents (runs of roughly sequential sectors). Whenever the game seeks, the
+/// transition from the previous extent's start to the new one is recorded, along with how long each
+/// extent ended up being. Profiles are keyed by disc serial and persisted in the cache directory, so
+/// level loads and streamed audio/data interleaving are predicted from the first seek on later runs.
+class CDVDPrefetcher
+{
+	DeclareNoncopyableObject(CDVDPrefetcher);
+
+public:
+	struct Extent
+	{
+		u32 lsn;
+		u32 count;
+	};
+
+	CDVDPrefetcher();
+	~CDVDPrefetcher();
+
+	/// Switches to the profile for `serial`, saving the current one first. An empty serial disables learning.
+	void SetProfile(std::string serial, u32 block_count);
+
+	/// Saves the current profile if it changed, logs the hit rate, and forgets it.
+	void Close();
+
+	/// Records a read of `lsn`. Returns the extent which should be read speculatively, count is zero if there is none.
+	Extent OnRead(u32 lsn);
+
+	/// Records how long the host waited for the data of the last read.
+	void OnReadFinished(Common::Timer::Value wait_time);
+
+private:
+	static constexpr u32 MAX_SUCCESSORS = 4;
+
+	struct Successor
+	{
+		u32 lsn;
+		u32 count;
+	};
+
+	struct ExtentInfo
+	{
+		/// Longest run observed starting at this sector
+		u32 length = 0;
+		u32 num_successors = 0;
+		Successor successors[MAX_SUCCESSORS] = {};
+	};
+
+	std::string GetProfilePath() const;
+	void Load();
+	void Save();
+	void ReportStats() const;
+
+	void RecordTransition(u32 from, u32 to);
+	void RecordLength(u32 start, u32 length);
+	Extent Predict(u32 lsn) const;
+
+	std::string m_serial;
+	u32 m_block_count = 0;
+	std::unordered_map<u32, ExtentInfo> m_extents;
+	bool m_dirty = false;
+
+	/// Current run of sequential reads, end is exclusive
+	u32 m_run_start = 0;
+	u32 m_run_end = 0;
+	bool m_has_run = false;
+
+	/// Outstanding prediction, judged on the next seek
+	Extent m_prediction = {};
+	bool m_last_read_was_seek = false;
+	bool m_last_read_was_hit = false;
+
+	u32 m_seeks = 0;
+	u32 m_predictions = 0;
+	u32 m_hits = 0;
+	u32 m_hit_waits = 0;
+	u32 m_miss_waits = 0;
+	Common::Timer::Value m_hit_wait_time = 0;
+	Common::Timer::Value m_miss_wait_time = 0;
+};
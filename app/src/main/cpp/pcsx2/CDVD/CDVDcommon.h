@@ -202,3 +202,6 @@ extern s32 DoCDVDreadTrack(u32 lsn, int mode);
 extern s32 DoCDVDgetBuffer(u8* buffer);
 extern s32 DoCDVDdetectDiskType();
 extern void DoCDVDresetDiskTypeCache();
+
+// Selects the seek profile of the ISO reader, called once the disc serial is known.
+extern void ISOsetPrefetchProfile(std::string serial);
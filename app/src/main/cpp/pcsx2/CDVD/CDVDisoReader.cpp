@@ -60,6 +60,11 @@ static bool ISOprecache(ProgressCallback* progress, Error* error)
 	return iso.Precache(progress, error);
 }
 
+void ISOsetPrefetchProfile(std::string serial)
+{
+	iso.SetPrefetchProfile(std::move(serial));
+}
+
 static s32 ISOreadSubQ(u32 lsn, cdvdSubQ* subq)
 {
 	// fake it
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "ChdFileReader.h"
+#include "Host.h"
 
 #include "common/Assertions.h"
 #include "common/Console.h"
@@ -11,15 +12,122 @@
 #include "common/ProgressCallback.h"
 #include "common/SmallString.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 
 #include "libchdr/chd.h"
 #include "fmt/format.h"
 #include "xxhash.h"
 
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 static constexpr u32 MAX_PARENTS = 32; // Surely someone wouldn't be insane enough to go beyond this...
 static std::vector<std::pair<std::string, chd_header>> s_chd_hash_cache; // <filename, header>
 static std::recursive_mutex s_chd_hash_cache_mutex;
 
+// Decoded parent hunks are shared by every chd_file whose parent has the same SHA1. Several children of one
+// parent, and the handles used by the parallel decode slots, then only decompress each parent hunk once.
+class ChdParentHunkCache
+{
+	DeclareNoncopyableObject(ChdParentHunkCache);
+
+public:
+	ChdParentHunkCache()
+	{
+		m_callbacks.param = this;
+		m_callbacks.lookup = Lookup;
+		m_callbacks.store = Store;
+	}
+
+	static const chd_hunk_cache* Get()
+	{
+		static ChdParentHunkCache s_cache;
+		return &s_cache.m_callbacks;
+	}
+
+private:
+	static constexpr size_t MAX_SIZE = 16 * 1024 * 1024;
+
+	struct Key
+	{
+		std::array<u8, CHD_SHA1_BYTES> sha1;
+		u32 hunk;
+
+		bool operator==(const Key& rhs) const { return hunk == rhs.hunk && sha1 == rhs.sha1; }
+	};
+
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const
+		{
+			// SHA1s are already uniformly distributed, so a few of their bytes make a fine hash.
+			u64 value;
+			std::memcpy(&value, key.sha1.data(), sizeof(value));
+			return static_cast<size_t>(value ^ (static_cast<u64>(key.hunk) * 0x9E3779B97F4A7C15ULL));
+		}
+	};
+
+	struct Entry
+	{
+		Key key;
+		std::unique_ptr<u8[]> data;
+		u32 size;
+	};
+
+	static Key MakeKey(const uint8_t* sha1, uint32_t hunknum)
+	{
+		Key key;
+		std::memcpy(key.sha1.data(), sha1, CHD_SHA1_BYTES);
+		key.hunk = hunknum;
+		return key;
+	}
+
+	static int Lookup(void* param, const uint8_t* sha1, uint32_t hunknum, void* dest, uint32_t hunkbytes)
+	{
+		ChdParentHunkCache* cache = static_cast<ChdParentHunkCache*>(param);
+		std::unique_lock lock(cache->m_mutex);
+		const auto it = cache->m_lookup.find(MakeKey(sha1, hunknum));
+		if (it == cache->m_lookup.end() || it->second->size != hunkbytes)
+			return 0;
+
+		std::memcpy(dest, it->second->data.get(), hunkbytes);
+		cache->m_entries.splice(cache->m_entries.begin(), cache->m_entries, it->second);
+		return 1;
+	}
+
+	static void Store(void* param, const uint8_t* sha1, uint32_t hunknum, const void* src, uint32_t hunkbytes)
+	{
+		ChdParentHunkCache* cache = static_cast<ChdParentHunkCache*>(param);
+		const Key key = MakeKey(sha1, hunknum);
+		std::unique_lock lock(cache->m_mutex);
+		if (hunkbytes > MAX_SIZE || cache->m_lookup.find(key) != cache->m_lookup.end())
+			return;
+
+		while (!cache->m_entries.empty() && cache->m_size + hunkbytes > MAX_SIZE)
+		{
+			const Entry& victim = cache->m_entries.back();
+			cache->m_size -= victim.size;
+			cache->m_lookup.erase(victim.key);
+			cache->m_entries.pop_back();
+		}
+
+		Entry& entry = cache->m_entries.emplace_front(Entry{key, std::make_unique_for_overwrite<u8[]>(hunkbytes), hunkbytes});
+		std::memcpy(entry.data.get(), src, hunkbytes);
+		cache->m_lookup.emplace(key, cache->m_entries.begin());
+		cache->m_size += hunkbytes;
+	}
+
+	chd_hunk_cache m_callbacks;
+	std::mutex m_mutex;
+	// Most recently used first.
+	std::list<Entry> m_entries;
+	std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_lookup;
+	size_t m_size = 0;
+};
+
 // Provides an implementation of core_file which allows us to control if the underlying FILE handle is freed.
 // Additionally, this class allows greater control and feedback while precaching CHD files.
 // The lifetime of ChdCoreFileWrapper will be equal to that of the relevant chd_file,
@@ -29,17 +137,24 @@ class ChdCoreFileWrapper
 	DeclareNoncopyableObject(ChdCoreFileWrapper);
 
 private:
+	// Precaching reads the file (and its parents) in slices spread over up to this many threads.
+	static constexpr u32 MAX_PRECACHE_THREADS = 4;
+	static constexpr size_t PRECACHE_SLICE_SIZE = 16 * 1024 * 1024;
+
 	core_file m_core;
+	std::string m_filename;
 	std::FILE* m_file;
 	bool m_free_file = false;
 	ChdCoreFileWrapper* m_parent = nullptr;
-	std::unique_ptr<u8[]> m_file_cache;
+	// Shared with the handles of the parallel decode slots, which read the same files.
+	std::shared_ptr<u8[]> m_file_cache;
 	s64 m_file_cache_size;
 	s64 m_file_cache_pos;
 
 public:
-	ChdCoreFileWrapper(std::FILE* file, ChdCoreFileWrapper* parent)
-		: m_file{file}
+	ChdCoreFileWrapper(std::string filename, std::FILE* file, ChdCoreFileWrapper* parent)
+		: m_filename{std::move(filename)}
+		, m_file{file}
 		, m_parent{parent}
 	{
 		m_core.argp = this;
@@ -79,69 +194,26 @@ public:
 			return size;
 	}
 
-	bool Precache(ProgressCallback* progress, Error* error)
-	{
-		progress->SetProgressRange(100);
+	bool Precache(ProgressCallback* progress, Error* error);
 
-		const s64 size = GetPrecacheSize();
-		return PrecacheInternal(progress, error, 0, size);
-	}
-
-private:
-	bool PrecacheInternal(ProgressCallback* progress, Error* error, s64 startSize, s64 finalSize)
+	/// Switches this file and its parents over to the precached data of another handle for the same files.
+	void ShareCache(const ChdCoreFileWrapper& source)
 	{
-		m_file_cache_size = FileSystem::FSize64(m_file);
-		if (m_file_cache_size <= 0)
-		{
-			Error::SetStringView(error, "Failed to determine file size.");
-			return false;
-		}
+		if (!source.m_file_cache || m_file_cache)
+			return;
 
-		// Copy the current file position.
-		m_file_cache_pos = FileSystem::FTell64(m_file);
-		if (m_file_cache_pos <= 0)
-		{
-			Error::SetStringView(error, "Failed to determine file position.");
-			return false;
-		}
-
-		m_file_cache = std::make_unique_for_overwrite<u8[]>(m_file_cache_size);
-		if (FileSystem::FSeek64(m_file, 0, SEEK_SET) != 0 ||
-			FileSystem::ReadFileWithPartialProgress(
-				m_file, m_file_cache.get(), m_file_cache_size, progress,
-				(startSize * 100) / finalSize,
-				((startSize + m_file_cache_size) * 100) / finalSize,
-				error) != static_cast<size_t>(m_file_cache_size))
-		{
-			m_file_cache.reset();
-			// Precache failed, continue using file
-			// Restore file position incase it's used for subsequent reads
-			FileSystem::FSeek64(m_file, m_file_cache_pos, SEEK_SET);
-			Error::SetStringView(error, "Failed to read part of the file.");
-			return false;
-		}
-
-		startSize += m_file_cache_size;
-
-		if (m_parent)
-		{
-			if (!m_parent->PrecacheInternal(progress, error, startSize, finalSize))
-			{
-				// Precache failed, continue using file
-				// Restore file position incase it's used for subsequent reads
-				FileSystem::FSeek64(m_file, m_file_cache_pos, SEEK_SET);
-				m_file_cache.reset();
-				return false;
-			}
-		}
-
-		if (m_free_file)
+		m_file_cache_pos = m_file ? FileSystem::FTell64(m_file) : 0;
+		m_file_cache = source.m_file_cache;
+		m_file_cache_size = source.m_file_cache_size;
+		if (m_free_file && m_file)
 			std::fclose(m_file);
 		m_file = nullptr;
 
-		return true;
+		if (m_parent && source.m_parent)
+			m_parent->ShareCache(*source.m_parent);
 	}
 
+private:
 	static u64 FSize(core_file* file)
 	{
 		ChdCoreFileWrapper* fileWrapper = FromCoreFile(file);
@@ -200,6 +272,143 @@ private:
 	}
 };
 
+bool ChdCoreFileWrapper::Precache(ProgressCallback* progress, Error* error)
+{
+	struct Slice
+	{
+		ChdCoreFileWrapper* file;
+		std::shared_ptr<u8[]> buffer;
+		s64 offset;
+		size_t size;
+	};
+
+	// Every file in the chain is read through handles of its own, so the ones libchdr uses stay untouched
+	// until everything has been read and a failure can simply fall back to them.
+	std::vector<ChdCoreFileWrapper*> files;
+	std::vector<std::shared_ptr<u8[]>> buffers;
+	std::vector<s64> sizes;
+	std::vector<Slice> slices;
+	u64 total_size = 0;
+	for (ChdCoreFileWrapper* file = this; file; file = file->m_parent)
+	{
+		const s64 size = FileSystem::FSize64(file->m_file);
+		if (size <= 0)
+		{
+			Error::SetStringView(error, "Failed to determine file size.");
+			return false;
+		}
+
+		std::shared_ptr<u8[]> buffer(new u8[static_cast<size_t>(size)]);
+		for (s64 offset = 0; offset < size; offset += PRECACHE_SLICE_SIZE)
+			slices.push_back({file, buffer, offset, static_cast<size_t>(std::min<s64>(size - offset, PRECACHE_SLICE_SIZE))});
+
+		files.push_back(file);
+		buffers.push_back(std::move(buffer));
+		sizes.push_back(size);
+		total_size += static_cast<u64>(size);
+	}
+
+	const u32 num_threads = std::min(std::clamp(std::thread::hardware_concurrency(), 1u, MAX_PRECACHE_THREADS),
+		static_cast<u32>(slices.size()));
+
+	std::atomic<size_t> next_slice{0};
+	std::atomic<u64> bytes_read{0};
+	std::atomic<u32> threads_done{0};
+	std::atomic_bool stop{false};
+	std::mutex error_mutex;
+	Error read_error;
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads);
+	for (u32 i = 0; i < num_threads; i++)
+	{
+		threads.emplace_back([&]() {
+			// Handles are opened per thread, and per file as the slices move through the chain.
+			const ChdCoreFileWrapper* open_file = nullptr;
+			FileSystem::ManagedCFilePtr fp;
+			for (size_t index = next_slice.fetch_add(1, std::memory_order_relaxed); index < slices.size() && !stop.load(std::memory_order_relaxed);
+				 index = next_slice.fetch_add(1, std::memory_order_relaxed))
+			{
+				const Slice& slice = slices[index];
+				Error slice_error;
+				if (open_file != slice.file)
+				{
+					fp = FileSystem::OpenManagedSharedCFile(
+						slice.file->m_filename.c_str(), "rb", FileSystem::FileShareMode::DenyWrite, &slice_error);
+					open_file = slice.file;
+				}
+
+				if (!fp || FileSystem::FSeek64(fp.get(), slice.offset, SEEK_SET) != 0 ||
+					std::fread(&slice.buffer[slice.offset], slice.size, 1, fp.get()) != 1)
+				{
+					if (fp)
+						Error::SetErrno(&slice_error, "fread() failed: ", errno);
+
+					const std::unique_lock lock(error_mutex);
+					if (!stop.exchange(true))
+						read_error = std::move(slice_error);
+					break;
+				}
+
+				bytes_read.fetch_add(slice.size, std::memory_order_relaxed);
+			}
+
+			threads_done.fetch_add(1, std::memory_order_release);
+		});
+	}
+
+	progress->SetProgressRange(100);
+	const std::string filename(Path::GetFileName(m_filename));
+	const Common::Timer timer;
+	bool cancelled = false;
+	while (threads_done.load(std::memory_order_acquire) < num_threads)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		const u64 done = bytes_read.load(std::memory_order_relaxed);
+		progress->SetProgressValue(static_cast<u32>((done * 100) / total_size));
+		progress->SetStatusText(SmallString::from_format(TRANSLATE_FS("CDVD", "Precaching {} ({:.1f} MB/s)..."), filename,
+			static_cast<double>(done) / 1048576.0 / std::max(timer.GetTimeSeconds(), 0.001)).c_str());
+
+		if (!cancelled && progress->IsCancelled())
+		{
+			cancelled = true;
+			stop.store(true, std::memory_order_relaxed);
+		}
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+
+	if (stop.load(std::memory_order_relaxed))
+	{
+		// Precache failed, continue using the files.
+		if (cancelled)
+			Error::SetStringView(error, "Precaching was cancelled.");
+		else if (error)
+			*error = std::move(read_error);
+		return false;
+	}
+
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		ChdCoreFileWrapper* file = files[i];
+
+		// Copy the current file position.
+		file->m_file_cache_pos = FileSystem::FTell64(file->m_file);
+		file->m_file_cache = std::move(buffers[i]);
+		file->m_file_cache_size = sizes[i];
+		if (file->m_free_file)
+			std::fclose(file->m_file);
+		file->m_file = nullptr;
+	}
+
+	const double seconds = timer.GetTimeSeconds();
+	Console.WriteLn(fmt::format("Precached {:.1f} MB of '{}' ({} files) on {} threads in {:.2f} seconds ({:.1f} MB/s).",
+		static_cast<double>(total_size) / 1048576.0, filename, files.size(), num_threads, seconds,
+		static_cast<double>(total_size) / 1048576.0 / std::max(seconds, 0.001)));
+	return true;
+}
+
 ChdFileReader::ChdFileReader() = default;
 
 ChdFileReader::~ChdFileReader()
@@ -234,7 +443,7 @@ static bool IsHeaderParentCHD(const chd_header& header, const chd_header& parent
 static chd_file* OpenCHD(const std::string& filename, FileSystem::ManagedCFilePtr fp, Error* error, u32 recursion_level)
 {
 	chd_file* chd;
-	ChdCoreFileWrapper* core_wrapper = new ChdCoreFileWrapper(fp.get(), nullptr);
+	ChdCoreFileWrapper* core_wrapper = new ChdCoreFileWrapper(filename, fp.get(), nullptr);
 	// libchdr will take ownership of core_wrapper, and will close/free it on failure.
 	chd_error err = chd_open_core_file(core_wrapper->GetCoreFile(), CHD_OPEN_READ, nullptr, &chd);
 	if (err == CHDERR_NONE)
@@ -348,7 +557,7 @@ static chd_file* OpenCHD(const std::string& filename, FileSystem::ManagedCFilePt
 	}
 
 	// Our last core file wrapper got freed, so make a new one.
-	core_wrapper = new ChdCoreFileWrapper(fp.get(), ChdCoreFileWrapper::FromCoreFile(chd_core_file(parent_chd)));
+	core_wrapper = new ChdCoreFileWrapper(filename, fp.get(), ChdCoreFileWrapper::FromCoreFile(chd_core_file(parent_chd)));
 	// Now try re-opening with the parent.
 	err = chd_open_core_file(core_wrapper->GetCoreFile(), CHD_OPEN_READ, parent_chd, &chd);
 	if (err != CHDERR_NONE)
@@ -378,6 +587,8 @@ bool ChdFileReader::Open2(std::string filename, Error* error)
 	if (!ChdFile)
 		return false;
 
+	chd_set_parent_hunk_cache(ChdFile, ChdParentHunkCache::Get());
+
 	const chd_header* chd_header = chd_get_header(ChdFile);
 	hunk_size = chd_header->hunkbytes;
 	// CHD likes to use full 2448 byte blocks, but keeps the +24 offset of source ISOs
@@ -397,16 +608,56 @@ bool ChdFileReader::Open2(std::string filename, Error* error)
 		file_size = static_cast<u64>(chd_header->unitbytes) * chd_header->unitcount;
 	}
 
+	OpenSlotFiles();
 	return true;
 }
 
+void ChdFileReader::OpenSlotFiles()
+{
+	// No point in opening more handles than the decode pool will use.
+	const u32 count = std::clamp(std::thread::hardware_concurrency() / 2, 1u, PARALLEL_DECODE_SLOTS);
+	for (u32 i = 0; i < count; i++)
+	{
+		auto fp = FileSystem::OpenManagedSharedCFile(m_filename.c_str(), "rb", FileSystem::FileShareMode::DenyWrite);
+		chd_file* chd = fp ? OpenCHD(m_filename, std::move(fp), nullptr, 0) : nullptr;
+		if (!chd)
+		{
+			// Decoding stays on the read thread.
+			Console.Warning(fmt::format("CDVD: Failed to open CHD decode handles for '{}'.", Path::GetFileName(m_filename)));
+			CloseSlotFiles();
+			return;
+		}
+
+		chd_set_parent_hunk_cache(chd, ChdParentHunkCache::Get());
+		m_slotFiles[i] = chd;
+		m_slotCount = i + 1;
+	}
+}
+
+void ChdFileReader::CloseSlotFiles()
+{
+	for (u32 i = 0; i < m_slotCount; i++)
+	{
+		chd_close(m_slotFiles[i]);
+		m_slotFiles[i] = nullptr;
+	}
+	m_slotCount = 0;
+}
+
 bool ChdFileReader::Precache2(ProgressCallback* progress, Error* error)
 {
 	ChdCoreFileWrapper* fileWrapper = ChdCoreFileWrapper::FromCoreFile(chd_core_file(ChdFile));
 	if (!CheckAvailableMemoryForPrecaching(fileWrapper->GetPrecacheSize(), error))
 		return false;
 
-	return fileWrapper->Precache(progress, error);
+	if (!fileWrapper->Precache(progress, error))
+		return false;
+
+	// The decode threads are stopped while precaching, so their handles can switch over too.
+	for (u32 i = 0; i < m_slotCount; i++)
+		ChdCoreFileWrapper::FromCoreFile(chd_core_file(m_slotFiles[i]))->ShareCache(*fileWrapper);
+
+	return true;
 }
 
 ThreadedFileReader::Chunk ChdFileReader::ChunkForOffset(u64 offset)
@@ -440,8 +691,30 @@ int ChdFileReader::ReadChunk(void* dst, s64 chunkID)
 	return hunk_size;
 }
 
+u32 ChdFileReader::GetParallelDecodeSlots() const
+{
+	return m_slotCount;
+}
+
+int ChdFileReader::ReadChunkParallel(void* dst, s64 chunkID, u32 slot)
+{
+	if (chunkID < 0)
+		return -1;
+
+	pxAssert(slot < m_slotCount);
+	chd_error error = chd_read(m_slotFiles[slot], chunkID, dst);
+	if (error != CHDERR_NONE)
+	{
+		Console.Error("CDVD: chd_read returned error: %s", chd_error_string(error));
+		return 0;
+	}
+
+	return hunk_size;
+}
+
 void ChdFileReader::Close2()
 {
+	CloseSlotFiles();
 	if (ChdFile)
 	{
 		chd_close(ChdFile);
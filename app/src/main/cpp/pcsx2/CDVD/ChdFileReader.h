@@ -3,6 +3,7 @@
 
 #pragma once
 #include "ThreadedFileReader.h"
+#include <array>
 #include <vector>
 
 typedef struct _chd_file chd_file;
@@ -21,14 +22,23 @@ public:
 
 	Chunk ChunkForOffset(u64 offset) override;
 	int ReadChunk(void* dst, s64 blockID) override;
+	u32 GetParallelDecodeSlots() const override;
+	int ReadChunkParallel(void* dst, s64 chunkID, u32 slot) override;
 
 	void Close2(void) override;
 	uint GetBlockCount(void) const override;
 
 private:
+	static constexpr u32 PARALLEL_DECODE_SLOTS = 4;
+
 	bool ParseTOC(u64* out_frame_count);
+	void OpenSlotFiles();
+	void CloseSlotFiles();
 
 	chd_file* ChdFile = nullptr;
+	// libchdr keeps codec state in the chd_file, so every decode slot gets its own handle (and parent chain).
+	std::array<chd_file*, PARALLEL_DECODE_SLOTS> m_slotFiles = {};
+	u32 m_slotCount = 0;
 	u64 file_size = 0;
 	u32 hunk_size = 0;
 };
@@ -103,7 +103,8 @@ bool CsoFileReader::Precache2(ProgressCallback* progress, Error* error)
 		return false;
 	}
 
-	m_readBuffer.reset();
+	for (DecodeContext& ctx : m_decodeContexts)
+		ctx.readBuffer.reset();
 	std::fclose(m_src);
 	m_src = nullptr;
 	return true;
@@ -146,14 +147,9 @@ bool CsoFileReader::InitializeBuffers(Error* error)
 	u32 numFrames = (u32)((m_totalSize + m_frameSize - 1) / m_frameSize);
 
 	// We might read a bit of alignment too, so be prepared.
-	if (m_frameSize + (1 << m_indexShift) < CSO_READ_BUFFER_SIZE)
-	{
-		m_readBuffer = std::make_unique<u8[]>(CSO_READ_BUFFER_SIZE);
-	}
-	else
-	{
-		m_readBuffer = std::make_unique<u8[]>(m_frameSize + (1 << m_indexShift));
-	}
+	const u32 readBufferSize = std::max<u32>(m_frameSize + (1 << m_indexShift), CSO_READ_BUFFER_SIZE);
+	for (DecodeContext& ctx : m_decodeContexts)
+		ctx.readBuffer = std::make_unique<u8[]>(readBufferSize);
 
 	const u32 indexSize = numFrames + 1;
 	m_index = std::make_unique<u32[]>(indexSize);
@@ -166,10 +162,14 @@ bool CsoFileReader::InitializeBuffers(Error* error)
 	// initialize zlib if not a ZSO
 	if (!m_uselz4)
 	{
-		if (inflateInit2(&m_z_stream, -15) != Z_OK)
+		for (DecodeContext& ctx : m_decodeContexts)
 		{
-			Error::SetString(error, "Unable to initialize zlib for CSO decompression.");
-			return false;
+			if (inflateInit2(&ctx.zStream, -15) != Z_OK)
+			{
+				Error::SetString(error, "Unable to initialize zlib for CSO decompression.");
+				return false;
+			}
+			ctx.zStreamInitialized = true;
 		}
 	}
 
@@ -187,10 +187,17 @@ void CsoFileReader::Close2()
 	}
 	if (m_file_cache)
 		m_file_cache.reset();
-	if (!m_uselz4)
-		inflateEnd(&m_z_stream);
 
-	m_readBuffer.reset();
+	for (DecodeContext& ctx : m_decodeContexts)
+	{
+		if (ctx.zStreamInitialized)
+		{
+			inflateEnd(&ctx.zStream);
+			ctx.zStreamInitialized = false;
+		}
+		ctx.readBuffer.reset();
+	}
+
 	m_index.reset();
 }
 
@@ -220,7 +227,25 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 	if (chunkID < 0)
 		return -1;
 
-	const u32 frame = chunkID;
+	return ReadFrame(dst, static_cast<u32>(chunkID), m_decodeContexts[0]);
+}
+
+u32 CsoFileReader::GetParallelDecodeSlots() const
+{
+	return PARALLEL_DECODE_SLOTS;
+}
+
+int CsoFileReader::ReadChunkParallel(void* dst, s64 chunkID, u32 slot)
+{
+	if (chunkID < 0)
+		return -1;
+
+	pxAssert(slot < PARALLEL_DECODE_SLOTS);
+	return ReadFrame(dst, static_cast<u32>(chunkID), m_decodeContexts[slot + 1]);
+}
+
+int CsoFileReader::ReadFrame(void* dst, u32 frame, DecodeContext& ctx)
+{
 
 	// Grab the index data for the frame we're about to read.
 	const bool compressed = (m_index[frame + 0] & 0x80000000) == 0;
@@ -244,6 +269,7 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 		}
 
 		// Just read directly, easy.
+		std::unique_lock lock(m_srcMutex);
 		if (FileSystem::FSeek64(m_src, frameRawPos, SEEK_SET) != 0)
 		{
 			Console.Error("Unable to seek to uncompressed CSO data.");
@@ -267,13 +293,14 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 		}
 		else
 		{
+			std::unique_lock lock(m_srcMutex);
 			if (FileSystem::FSeek64(m_src, frameRawPos, SEEK_SET) != 0)
 			{
 				Console.Error("Unable to seek to compressed CSO data.");
 				return 0;
 			}
-			readBuffer = m_readBuffer.get();
-			readRawBytes = fread(m_readBuffer.get(), 1, frameRawSize, m_src);
+			readBuffer = ctx.readBuffer.get();
+			readRawBytes = fread(ctx.readBuffer.get(), 1, frameRawSize, m_src);
 		}
 
 		bool success = false;
@@ -290,20 +317,20 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 		}
 		else
 		{
-			m_z_stream.next_in = readBuffer;
-			m_z_stream.avail_in = readRawBytes;
-			m_z_stream.next_out = static_cast<Bytef*>(dst);
-			m_z_stream.avail_out = m_frameSize;
+			ctx.zStream.next_in = readBuffer;
+			ctx.zStream.avail_in = readRawBytes;
+			ctx.zStream.next_out = static_cast<Bytef*>(dst);
+			ctx.zStream.avail_out = m_frameSize;
 
-			const int status = inflate(&m_z_stream, Z_FINISH);
-			success = (status == Z_STREAM_END && m_z_stream.total_out == m_frameSize);
+			const int status = inflate(&ctx.zStream, Z_FINISH);
+			success = (status == Z_STREAM_END && ctx.zStream.total_out == m_frameSize);
 		}
 
 		if (!success)
 			Console.Error(fmt::format("Unable to decompress CSO frame using {}", (m_uselz4)? "lz4":"zlib"));
 		
 		if (!m_uselz4)
-			inflateReset(&m_z_stream);
+			inflateReset(&ctx.zStream);
 
 		return success ? m_frameSize : 0;
 	}
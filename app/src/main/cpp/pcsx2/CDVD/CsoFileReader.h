@@ -4,6 +4,9 @@
 #pragma once
 
 #include "ThreadedFileReader.h"
+
+#include <array>
+#include <mutex>
 #include <zlib.h>
 
 struct CsoHeader;
@@ -22,30 +25,45 @@ public:
 
 	Chunk ChunkForOffset(u64 offset) override;
 	int ReadChunk(void* dst, s64 chunkID) override;
+	u32 GetParallelDecodeSlots() const override;
+	int ReadChunkParallel(void* dst, s64 chunkID, u32 slot) override;
 
 	void Close2() override;
 
 	u32 GetBlockCount() const override;
 
 private:
+	/// Frames are small and cheap to decode individually, so a few threads are enough to keep up with flash storage.
+	static constexpr u32 PARALLEL_DECODE_SLOTS = 4;
+
+	struct DecodeContext
+	{
+		std::unique_ptr<u8[]> readBuffer;
+		z_stream zStream = {};
+		bool zStreamInitialized = false;
+	};
+
 	static bool ValidateHeader(const CsoHeader& hdr, Error* error);
 	bool ReadFileHeader(Error* error);
 	bool InitializeBuffers(Error* error);
 	int ReadFromFrame(u8* dest, u64 pos, int maxBytes);
 	bool DecompressFrame(Bytef* dst, u32 frame, u32 readBufferSize);
 	bool DecompressFrame(u32 frame, u32 readBufferSize);
+	int ReadFrame(void* dst, u32 frame, DecodeContext& ctx);
 
 	u32 m_frameSize = 0;
 	u8 m_frameShift = 0;
 	u8 m_indexShift = 0;
 	bool m_uselz4 = false; // flag to enable LZ4 decompression (ZSO files)
-	std::unique_ptr<u8[]> m_readBuffer;
+	// Context 0 belongs to ReadChunk(), the others to the parallel decode slots.
+	std::array<DecodeContext, PARALLEL_DECODE_SLOTS + 1> m_decodeContexts;
 
 	std::unique_ptr<u32[]> m_index;
 	u64 m_totalSize = 0;
 	// The actual source cso file handle.
 	std::FILE* m_src = nullptr;
+	// Serializes seeking and reading m_src between decode threads.
+	std::mutex m_srcMutex;
 	std::unique_ptr<u8[]> m_file_cache;
 	size_t m_file_cache_size = 0;
-	z_stream m_z_stream = {};
 };
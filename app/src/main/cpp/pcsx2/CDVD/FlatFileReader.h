@@ -14,6 +14,10 @@ class FlatFileReader final : public ThreadedFileReader
 	std::FILE* m_file = nullptr;
 	std::unique_ptr<u8[]> m_file_cache;
 	u64 m_file_size = 0;
+	/// Mapping of the whole file, null if mapping isn't supported or failed
+	void* m_mapping = nullptr;
+
+	void Unmap();
 
 public:
 	FlatFileReader();
@@ -25,6 +29,7 @@ public:
 
 	Chunk ChunkForOffset(u64 offset) override;
 	int ReadChunk(void* dst, s64 blockID) override;
+	void PrefetchRange(u64 offset, u32 size) override;
 
 	void Close2() override;
 
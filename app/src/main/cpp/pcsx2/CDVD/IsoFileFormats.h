@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CDVD/CDVD.h"
+#include "CDVD/CDVDPrefetcher.h"
 #include "CDVD/ThreadedFileReader.h"
 #include <memory>
 #include <string>
@@ -33,6 +34,7 @@ class InputIsoFile final
 protected:
 	std::string m_filename;
 	std::unique_ptr<ThreadedFileReader> m_reader;
+	CDVDPrefetcher m_prefetcher;
 
 	u32 m_current_lsn;
 
@@ -48,6 +50,8 @@ protected:
 
 	bool m_read_inprogress;
 	uint m_read_lsn;
+	/// Data of m_read_lsn, either m_readbuffer or the reader's mapping of the image
+	const u8* m_read_ptr;
 	u8 m_readbuffer[CD_FRAMESIZE_RAW];
 
 public:
@@ -70,6 +74,9 @@ public:
 	void Close();
 	bool Detect(bool readType = true);
 
+	/// Selects the seek profile used to prefetch from this image, an empty serial disables prefetching.
+	void SetPrefetchProfile(std::string serial);
+
 	int ReadSync(u8* dst, uint lsn);
 
 	void BeginRead2(uint lsn);
@@ -4,6 +4,7 @@
 #include "ThreadedFileReader.h"
 #include "Host.h"
 
+#include "common/Console.h"
 #include "common/Error.h"
 #include "common/HostSys.h"
 #include "common/Path.h"
@@ -11,12 +12,22 @@
 #include "common/SmallString.h"
 #include "common/Threading.h"
 
+#include <algorithm>
 #include <cstring>
 
 // Make sure buffer size is bigger than the cutoff where PCSX2 emulates a seek
 // If buffers are smaller than that, we can't keep up with linear reads
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
 
+// Parallel decoding: decoded chunks are kept in a cache of CHUNK_CACHE_SIZE bytes. Readahead restarts at
+// MINIMUM_SIZE after every seek and doubles with each sequential read, up to MAXIMUM_READAHEAD.
+static constexpr u64 CHUNK_CACHE_SIZE = 32 * 1024 * 1024;
+static constexpr u32 MAXIMUM_READAHEAD = 8 * 1024 * 1024;
+static constexpr u32 MAXIMUM_DECODE_THREADS = 4;
+// Decode threads claim runs of consecutive queued chunks up to this size, so formats with small chunks
+// (e.g. 2 KB CSO frames) don't pay a wakeup and lock round trip per chunk.
+static constexpr u32 DECODE_BATCH_SIZE = 64 * 1024;
+
 ThreadedFileReader::ThreadedFileReader()
 {
 	m_readThread = std::thread([](ThreadedFileReader* r){ r->Loop(); }, this);
@@ -24,6 +35,7 @@ ThreadedFileReader::ThreadedFileReader()
 
 ThreadedFileReader::~ThreadedFileReader()
 {
+	StopDecodeThreads();
 	m_quit = true;
 	(void)std::lock_guard<std::mutex>{m_mtx};
 	m_condition.notify_one();
@@ -96,7 +108,8 @@ void ThreadedFileReader::Loop()
 			break;
 		}
 
-		if (ok)
+		// With parallel decoding, readahead is queued to the decode threads when the request comes in.
+		if (ok && !UsesDecodeThreads())
 		{
 			// Readahead
 			Chunk chunk = ChunkForOffset(requestOffset + requestSize);
@@ -183,6 +196,9 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 
 bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 {
+	if (UsesDecodeThreads())
+		return DecompressCached(target, begin, size);
+
 	char* write = static_cast<char*>(target);
 	u32 remaining = size;
 	u64 off = begin;
@@ -222,6 +238,9 @@ bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 
 bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, const std::lock_guard<std::mutex>&)
 {
+	if (UsesDecodeThreads())
+		return TryCachedChunkRead(buffer, offset, size);
+
 	// Run through twice so that if m_buffer[1] contains the first half and m_buffer[0] contains the second half it still works
 	m_amtRead = 0;
 	u64 end = 0;
@@ -251,11 +270,325 @@ bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, co
 	return allDone;
 }
 
+u32 ThreadedFileReader::GetParallelDecodeSlots() const
+{
+	return 0;
+}
+
+int ThreadedFileReader::ReadChunkParallel(void* dst, s64 chunkID, u32 slot)
+{
+	return -1;
+}
+
+void ThreadedFileReader::PrefetchRange(u64 offset, u32 size)
+{
+}
+
+void ThreadedFileReader::StartDecodeThreads()
+{
+	const u32 slots = GetParallelDecodeSlots();
+	if (slots == 0 || !m_decode_threads.empty())
+		return;
+
+	const u32 count = std::min(slots, std::clamp(std::thread::hardware_concurrency() / 2, 1u, MAXIMUM_DECODE_THREADS));
+
+	m_decode_quit = false;
+	m_readahead_size = MINIMUM_SIZE;
+	m_last_read_end = 0;
+	for (u32 i = 0; i < count; i++)
+		m_decode_threads.emplace_back([this, i]() { DecodeLoop(i); });
+
+	DevCon.WriteLn(fmt::format("CDVD: Decompressing '{}' on {} threads.", Path::GetFileName(m_filename), count));
+}
+
+void ThreadedFileReader::StopDecodeThreads()
+{
+	if (m_decode_threads.empty())
+		return;
+
+	{
+		std::unique_lock<std::mutex> lock(m_cache_mtx);
+		m_decode_quit = true;
+		for (std::deque<s64>& queue : m_decode_queues)
+			queue.clear();
+	}
+	m_decode_condition.notify_all();
+
+	for (std::thread& thread : m_decode_threads)
+		thread.join();
+	m_decode_threads.clear();
+
+	m_chunk_cache.clear();
+	m_chunk_lru.clear();
+	m_cache_bytes = 0;
+}
+
+void ThreadedFileReader::DecodeLoop(u32 slot)
+{
+	Threading::SetNameOfCurrentThread("ISO Decode Worker");
+
+	struct BatchEntry
+	{
+		s64 chunkID;
+		CachedChunk* cc;
+		int amt;
+	};
+	std::vector<BatchEntry> batch;
+
+	std::unique_lock<std::mutex> lock(m_cache_mtx);
+
+	for (;;)
+	{
+		std::deque<s64>* queue;
+		while (!(queue = GetDecodeQueue(lock)) && !m_decode_quit)
+			m_decode_condition.wait(lock);
+
+		if (m_decode_quit)
+			return;
+
+		batch.clear();
+		u32 batch_bytes = 0;
+		while (!queue->empty() && batch_bytes < DECODE_BATCH_SIZE)
+		{
+			const s64 chunkID = queue->front();
+			if (!batch.empty() && chunkID != batch.back().chunkID + 1)
+				break;
+
+			queue->pop_front();
+
+			auto it = m_chunk_cache.find(chunkID);
+			if (it == m_chunk_cache.end() || it->second.state != CachedChunk::State::Queued)
+				continue;
+
+			// Entries are never evicted while decoding, and unordered_map nodes don't move, so the data can be written unlocked.
+			CachedChunk& cc = it->second;
+			cc.state = CachedChunk::State::Decoding;
+			if (!cc.data)
+				cc.data = std::make_unique_for_overwrite<u8[]>(cc.length);
+
+			batch.push_back({chunkID, &cc, 0});
+			batch_bytes += cc.length;
+		}
+
+		if (batch.empty())
+			continue;
+
+		lock.unlock();
+		for (BatchEntry& entry : batch)
+			entry.amt = ReadChunkParallel(entry.cc->data.get(), entry.chunkID, slot);
+		lock.lock();
+
+		for (const BatchEntry& entry : batch)
+		{
+			entry.cc->size = (entry.amt > 0) ? static_cast<u32>(entry.amt) : 0;
+			entry.cc->state = (entry.amt > 0) ? CachedChunk::State::Ready : CachedChunk::State::Failed;
+		}
+		m_chunk_ready_condition.notify_all();
+	}
+}
+
+std::deque<s64>* ThreadedFileReader::GetDecodeQueue(const std::unique_lock<std::mutex>&)
+{
+	for (std::deque<s64>& queue : m_decode_queues)
+	{
+		if (!queue.empty())
+			return &queue;
+	}
+
+	return nullptr;
+}
+
+ThreadedFileReader::CachedChunk& ThreadedFileReader::QueueChunk(const Chunk& chunk, DecodePriority priority, const std::unique_lock<std::mutex>& lock)
+{
+	auto [it, inserted] = m_chunk_cache.try_emplace(chunk.chunkID);
+	CachedChunk& cc = it->second;
+	if (inserted)
+	{
+		cc.offset = chunk.offset;
+		cc.length = chunk.length;
+		cc.lru = m_chunk_lru.insert(m_chunk_lru.end(), chunk.chunkID);
+		m_cache_bytes += chunk.length;
+		EvictChunks(lock);
+	}
+	else if (cc.state == CachedChunk::State::Failed && cc.pins == 0)
+	{
+		// Give chunks which failed earlier another chance.
+		cc.state = CachedChunk::State::Queued;
+		inserted = true;
+	}
+	else
+	{
+		TouchChunk(cc, lock);
+	}
+
+	if (priority == DecodePriority::Prefetch)
+		cc.prefetched = true;
+
+	// New chunks go in the queue for their priority, queued ones move up if someone needs them sooner.
+	if (inserted || (cc.state == CachedChunk::State::Queued && priority < cc.priority))
+	{
+		cc.priority = priority;
+		m_decode_queues[static_cast<size_t>(priority)].push_back(chunk.chunkID);
+		if (priority == DecodePriority::Urgent)
+			m_decode_condition.notify_one();
+	}
+
+	return cc;
+}
+
+void ThreadedFileReader::TouchChunk(CachedChunk& cc, const std::unique_lock<std::mutex>&)
+{
+	m_chunk_lru.splice(m_chunk_lru.end(), m_chunk_lru, cc.lru);
+}
+
+void ThreadedFileReader::EraseChunk(std::unordered_map<s64, CachedChunk>::iterator it, const std::unique_lock<std::mutex>&)
+{
+	m_cache_bytes -= it->second.length;
+	m_chunk_lru.erase(it->second.lru);
+	m_chunk_cache.erase(it);
+}
+
+void ThreadedFileReader::EvictChunks(const std::unique_lock<std::mutex>& lock)
+{
+	// Queued and pinned chunks are skipped, there are only ever a readahead window's worth of them.
+	// If that's all that's left, let the cache run over budget until they're consumed.
+	for (auto lru = m_chunk_lru.begin(); lru != m_chunk_lru.end() && m_cache_bytes > CHUNK_CACHE_SIZE;)
+	{
+		const auto it = m_chunk_cache.find(*lru);
+		++lru;
+
+		const CachedChunk& cc = it->second;
+		if (cc.pins == 0 && (cc.state == CachedChunk::State::Ready || cc.state == CachedChunk::State::Failed))
+			EraseChunk(it, lock);
+	}
+}
+
+void ThreadedFileReader::QueueReadahead(u64 offset, u32 size, const std::unique_lock<std::mutex>& lock)
+{
+	// Reads continuing forward from the last one grow the window, anything else is a seek and resets it.
+	if (offset >= m_last_read_end && offset - m_last_read_end <= m_readahead_size)
+	{
+		m_readahead_size = std::min(m_readahead_size * 2, MAXIMUM_READAHEAD);
+	}
+	else
+	{
+		m_readahead_size = MINIMUM_SIZE;
+
+		// Readahead for the old position is useless now, drop whatever hasn't started decoding. Prefetched
+		// chunks stay, the seek is often the one they were predicted for, and so do chunks the new read needs.
+		const u64 keep_end = offset + size + MINIMUM_SIZE;
+		std::deque<s64>& queue = m_decode_queues[static_cast<size_t>(DecodePriority::Readahead)];
+		for (auto it = queue.begin(); it != queue.end();)
+		{
+			auto cc = m_chunk_cache.find(*it);
+			if (cc != m_chunk_cache.end() && cc->second.pins == 0 && cc->second.state == CachedChunk::State::Queued &&
+				cc->second.priority == DecodePriority::Readahead && !cc->second.prefetched &&
+				(cc->second.offset + cc->second.length <= offset || cc->second.offset >= keep_end))
+			{
+				EraseChunk(cc, lock);
+				it = queue.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	m_last_read_end = offset + size;
+
+	const u64 end = m_last_read_end + m_readahead_size;
+	for (u64 pos = m_last_read_end; pos < end;)
+	{
+		const Chunk chunk = ChunkForOffset(pos);
+		if (chunk.chunkID < 0)
+			break;
+
+		QueueChunk(chunk, DecodePriority::Readahead, lock);
+		pos = chunk.offset + chunk.length;
+	}
+	m_decode_condition.notify_all();
+}
+
+bool ThreadedFileReader::DecompressCached(void* target, u64 begin, u32 size)
+{
+	char* write = static_cast<char*>(target);
+	u32 remaining = size;
+	u64 off = begin;
+
+	std::unique_lock<std::mutex> lock(m_cache_mtx);
+	while (remaining)
+	{
+		if (m_requestCancelled.load(std::memory_order_relaxed))
+			return false;
+
+		const Chunk chunk = ChunkForOffset(off);
+		if (chunk.chunkID < 0)
+			return false;
+
+		CachedChunk& cc = QueueChunk(chunk, DecodePriority::Urgent, lock);
+		cc.pins++;
+		while (cc.state == CachedChunk::State::Queued || cc.state == CachedChunk::State::Decoding)
+			m_chunk_ready_condition.wait(lock);
+		cc.pins--;
+
+		const u32 bufoff = static_cast<u32>(off - cc.offset);
+		if (cc.state != CachedChunk::State::Ready || cc.size <= bufoff)
+			return false;
+
+		const u32 len = std::min(cc.size - bufoff, remaining);
+		write += CopyBlocks(write, cc.data.get() + bufoff, len);
+		remaining -= len;
+		off += len;
+	}
+
+	m_amtRead += write - static_cast<char*>(target);
+	return true;
+}
+
+bool ThreadedFileReader::TryCachedChunkRead(void*& buffer, u64& offset, u32& size)
+{
+	m_amtRead = 0;
+
+	std::unique_lock<std::mutex> lock(m_cache_mtx);
+	QueueReadahead(offset, size, lock);
+
+	while (size > 0)
+	{
+		const Chunk chunk = ChunkForOffset(offset);
+		if (chunk.chunkID < 0)
+			break;
+
+		auto it = m_chunk_cache.find(chunk.chunkID);
+		if (it == m_chunk_cache.end() || it->second.state != CachedChunk::State::Ready)
+			break;
+
+		CachedChunk& cc = it->second;
+		const u32 bufoff = static_cast<u32>(offset - cc.offset);
+		if (cc.size <= bufoff)
+			break;
+
+		const u32 cpysize = std::min(size, cc.size - bufoff);
+		const size_t read = CopyBlocks(buffer, cc.data.get() + bufoff, cpysize);
+		TouchChunk(cc, lock);
+		m_amtRead += read;
+		size -= cpysize;
+		offset += cpysize;
+		buffer = static_cast<char*>(buffer) + read;
+	}
+
+	// Readahead has already been queued, so there's nothing left for the read thread when everything was cached.
+	return (size == 0);
+}
+
 bool ThreadedFileReader::Precache(ProgressCallback* progress, Error* error)
 {
 	CancelAndWaitUntilStopped();
+	StopDecodeThreads();
 	progress->SetStatusText(SmallString::from_format(TRANSLATE_FS("CDVD", "Precaching {}..."), Path::GetFileName(m_filename)).c_str());
-	return Precache2(progress, error);
+	const bool result = Precache2(progress, error);
+	StartDecodeThreads();
+	return result;
 }
 
 bool ThreadedFileReader::Precache2(ProgressCallback* progress, Error* error)
@@ -286,7 +619,15 @@ bool ThreadedFileReader::CheckAvailableMemoryForPrecaching(u64 required_size, Er
 bool ThreadedFileReader::Open(std::string filename, Error* error)
 {
 	CancelAndWaitUntilStopped();
-	return Open2(std::move(filename), error);
+	StopDecodeThreads();
+	m_readahead_size = MINIMUM_SIZE;
+	m_last_read_end = 0;
+	m_advised_end = 0;
+	if (!Open2(std::move(filename), error))
+		return false;
+
+	StartDecodeThreads();
+	return true;
 }
 
 int ThreadedFileReader::ReadSync(void* pBuffer, u32 sector, u32 count)
@@ -294,6 +635,9 @@ int ThreadedFileReader::ReadSync(void* pBuffer, u32 sector, u32 count)
 	u32 blocksize = InternalBlockSize();
 	u64 offset = (u64)sector * (u64)blocksize + m_dataoffset;
 	u32 size = count * blocksize;
+	if (UsesMapping())
+		return ReadMapped(pBuffer, offset, size);
+
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
 		if (TryCachedRead(pBuffer, offset, size, l))
@@ -348,6 +692,13 @@ void ThreadedFileReader::BeginRead(void* pBuffer, u32 sector, u32 count)
 	s32 blocksize = InternalBlockSize();
 	u64 offset = (u64)sector * (u64)blocksize + m_dataoffset;
 	u32 size = count * blocksize;
+	if (UsesMapping())
+	{
+		// Nothing to wait for, FinishRead() returns the amount straight away.
+		ReadMapped(pBuffer, offset, size);
+		return;
+	}
+
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
 		if (TryCachedRead(pBuffer, offset, size, l))
@@ -370,6 +721,77 @@ void ThreadedFileReader::BeginRead(void* pBuffer, u32 sector, u32 count)
 	m_condition.notify_one();
 }
 
+void ThreadedFileReader::AdviseMapped(u64 offset, u32 size)
+{
+	const u64 end = offset + size;
+	const bool sequential = (offset >= m_last_read_end && offset - m_last_read_end <= m_readahead_size);
+	m_last_read_end = end;
+
+	// Only hint again once reads get close to the end of the last window, not for every sector.
+	if (sequential && end + m_readahead_size / 2 <= m_advised_end)
+		return;
+
+	m_readahead_size = sequential ? std::min(m_readahead_size * 2, MAXIMUM_READAHEAD) : MINIMUM_SIZE;
+
+	const u64 start = sequential ? std::max(offset, m_advised_end) : offset;
+	m_advised_end = std::min(end + m_readahead_size, m_mapped_size);
+	if (start < m_advised_end)
+		PrefetchRange(start, static_cast<u32>(m_advised_end - start));
+}
+
+int ThreadedFileReader::ReadMapped(void* dst, u64 offset, u32 size)
+{
+	if (offset >= m_mapped_size)
+	{
+		m_amtRead = -1;
+		return -1;
+	}
+
+	size = static_cast<u32>(std::min<u64>(size, m_mapped_size - offset));
+	AdviseMapped(offset, size);
+	m_amtRead = static_cast<int>(CopyBlocks(dst, m_mapped_data + offset, size));
+	return m_amtRead;
+}
+
+const u8* ThreadedFileReader::GetMappedBlock(u32 sector)
+{
+	if (!UsesMapping() || m_internalBlockSize)
+		return nullptr;
+
+	const u64 offset = static_cast<u64>(sector) * m_blocksize + m_dataoffset;
+	if (offset + m_blocksize > m_mapped_size)
+		return nullptr;
+
+	AdviseMapped(offset, m_blocksize);
+	return m_mapped_data + offset;
+}
+
+void ThreadedFileReader::Prefetch(u32 sector, u32 count)
+{
+	const u32 blocksize = InternalBlockSize();
+	const u64 offset = static_cast<u64>(sector) * blocksize + m_dataoffset;
+	const u32 size = std::min(count * blocksize, MAXIMUM_READAHEAD);
+
+	if (!UsesDecodeThreads())
+	{
+		PrefetchRange(offset, size);
+		return;
+	}
+
+	// Behind any urgent reads, but decoded before the sequential readahead.
+	std::unique_lock<std::mutex> lock(m_cache_mtx);
+	for (u64 pos = offset; pos < offset + size;)
+	{
+		const Chunk chunk = ChunkForOffset(pos);
+		if (chunk.chunkID < 0)
+			break;
+
+		QueueChunk(chunk, DecodePriority::Prefetch, lock);
+		pos = chunk.offset + chunk.length;
+	}
+	m_decode_condition.notify_all();
+}
+
 int ThreadedFileReader::FinishRead(void)
 {
 	if (m_requestPtr.load(std::memory_order_acquire) == nullptr)
@@ -393,6 +815,7 @@ void ThreadedFileReader::CancelRead(void)
 void ThreadedFileReader::Close(void)
 {
 	CancelAndWaitUntilStopped();
+	StopDecodeThreads();
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
 	Close2();
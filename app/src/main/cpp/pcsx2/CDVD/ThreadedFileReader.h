@@ -7,8 +7,14 @@
 
 #include <thread>
 #include <mutex>
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 class Error;
 class ProgressCallback;
@@ -32,6 +38,12 @@ protected:
 		u32 length;
 	};
 
+	/// Set by readers which can expose the whole image in memory (e.g. a file mapping) from Open2()/Precache2()
+	/// Reads then copy straight from it on the calling thread, bypassing the read thread and its buffers
+	/// Must stay valid until Close2() and be cleared there
+	const u8* m_mapped_data = nullptr;
+	u64 m_mapped_size = 0;
+
 	/// Set nonzero to separate block size of read blocks from m_blocksize
 	/// Requires that chunk size is a multiple of internal block size
 	/// Use to avoid overrunning stack because PCSX2 likes to allocate 2448-byte buffers
@@ -41,6 +53,17 @@ protected:
 	virtual Chunk ChunkForOffset(u64 offset) = 0;
 	/// Synchronously read the given block into `dst`
 	virtual int ReadChunk(void* dst, s64 chunkID) = 0;
+	/// Number of threads which may call ReadChunkParallel() at the same time
+	/// Zero (the default) keeps all decompression on the read thread, otherwise chunks are decoded by a pool of
+	/// threads into an LRU chunk cache, with readahead that grows while reads stay sequential
+	virtual u32 GetParallelDecodeSlots() const;
+	/// Thread-safe variant of ReadChunk
+	/// `slot` is below GetParallelDecodeSlots() and never used by two threads at once, so it can index per-thread decoder state
+	virtual int ReadChunkParallel(void* dst, s64 chunkID, u32 slot);
+	/// Hint that the given range (in internal block bytes) is likely to be read soon
+	/// Only called when decoding isn't parallel, e.g. to ask the OS to start reading the range in
+	/// Mapped images also get the range ahead of sequential reads here, in place of the read thread's readahead
+	virtual void PrefetchRange(u64 offset, u32 size);
 	/// AsyncFileReader open but ThreadedFileReader needs prep work first
 	virtual bool Open2(std::string filename, Error* error) = 0;
 	/// AsyncFileReader precache but ThreadedFileReader needs prep work first
@@ -76,6 +99,67 @@ private:
 	Buffer m_buffer[2];
 	u32 m_nextBuffer = 0;
 
+	/// Order in which queued chunks are decoded
+	enum class DecodePriority : u8
+	{
+		/// A reader is waiting on the chunk
+		Urgent,
+		/// Predicted by Prefetch()
+		Prefetch,
+		/// Sequential readahead
+		Readahead,
+		Count
+	};
+
+	struct CachedChunk
+	{
+		enum class State : u8
+		{
+			Queued,
+			Decoding,
+			Ready,
+			Failed,
+		};
+
+		std::unique_ptr<u8[]> data;
+		u64 offset = 0;
+		/// Capacity of `data`, the chunk length reported by ChunkForOffset
+		u32 length = 0;
+		/// Number of decoded bytes, valid once Ready
+		u32 size = 0;
+		/// Readers currently waiting on or copying from this chunk, pinned chunks are never evicted
+		u32 pins = 0;
+		State state = State::Queued;
+		/// Highest priority the chunk was queued with, while Queued
+		DecodePriority priority = DecodePriority::Readahead;
+		/// Queued by Prefetch(), kept when a seek drops the old readahead
+		bool prefetched = false;
+		/// Position in `m_chunk_lru`
+		std::list<s64>::iterator lru;
+	};
+
+	/// Decoded chunks, only used with parallel decoding. Guarded by `m_cache_mtx`.
+	std::unordered_map<s64, CachedChunk> m_chunk_cache;
+	/// IDs of the cached chunks, least recently used first
+	std::list<s64> m_chunk_lru;
+	/// Chunk IDs waiting for a decode thread, by priority
+	/// A chunk moved to a higher priority stays in its old queue too, the decode threads skip it there
+	std::array<std::deque<s64>, static_cast<size_t>(DecodePriority::Count)> m_decode_queues;
+	std::vector<std::thread> m_decode_threads;
+	std::mutex m_cache_mtx;
+	/// Signalled when chunks are queued, for the decode threads
+	std::condition_variable m_decode_condition;
+	/// Signalled when a chunk finishes decoding, for readers
+	std::condition_variable m_chunk_ready_condition;
+	u64 m_cache_bytes = 0;
+	/// End offset of the last read request, used to detect sequential access
+	u64 m_last_read_end = 0;
+	/// Current readahead window in bytes
+	u32 m_readahead_size = 0;
+	/// End of the range last passed to PrefetchRange() by mapped reads
+	u64 m_advised_end = 0;
+	bool m_decode_quit = false;
+
 	std::thread m_readThread;
 	std::mutex m_mtx;
 	std::condition_variable m_condition;
@@ -95,6 +179,35 @@ private:
 	/// Main loop of read thread
 	void Loop();
 
+	bool UsesDecodeThreads() const { return !m_decode_threads.empty(); }
+	void StartDecodeThreads();
+	void StopDecodeThreads();
+	/// Main loop of the parallel decode threads
+	void DecodeLoop(u32 slot);
+	/// Returns the cache entry for `chunk`, queuing it for decoding if it isn't cached yet
+	/// Only urgent chunks wake a decode thread, callers queuing readahead notify once they're done
+	CachedChunk& QueueChunk(const Chunk& chunk, DecodePriority priority, const std::unique_lock<std::mutex>&);
+	/// Returns the highest priority queue with chunks waiting, or null if there are none
+	std::deque<s64>* GetDecodeQueue(const std::unique_lock<std::mutex>&);
+	/// Marks the chunk as the most recently used one
+	void TouchChunk(CachedChunk& cc, const std::unique_lock<std::mutex>&);
+	/// Removes the chunk from the cache
+	void EraseChunk(std::unordered_map<s64, CachedChunk>::iterator it, const std::unique_lock<std::mutex>&);
+	/// Drops least recently used decoded chunks until the cache is within its budget
+	void EvictChunks(const std::unique_lock<std::mutex>&);
+	/// Adapts the readahead window to the request and queues the chunks following it
+	void QueueReadahead(u64 offset, u32 size, const std::unique_lock<std::mutex>&);
+	/// Decompress through the chunk cache, waiting for the decode threads where needed
+	bool DecompressCached(void* ptr, u64 offset, u32 size);
+	/// TryCachedRead for the chunk cache, copies only chunks which have already been decoded
+	bool TryCachedChunkRead(void*& buffer, u64& offset, u32& size);
+
+	bool UsesMapping() const { return m_mapped_data != nullptr; }
+	/// Hints the range following a mapped read to PrefetchRange(), growing the window while reads stay sequential
+	void AdviseMapped(u64 offset, u32 size);
+	/// Copies from the mapping, returns the number of external block bytes read or -1 if out of range
+	int ReadMapped(void* dst, u64 offset, u32 size);
+
 	/// Load the given block into one of the `m_buffer` buffers if necessary and return a pointer to its contents if successful
 	Buffer* GetBlockPtr(const Chunk& block);
 	/// Decompress from offset to size into
@@ -119,6 +232,11 @@ public:
 	bool Precache(ProgressCallback* progress, Error* error);
 	int ReadSync(void* pBuffer, u32 sector, u32 count);
 	void BeginRead(void* pBuffer, u32 sector, u32 count);
+	/// Returns the data of `sector` if the image is mapped and its blocks need no repacking, null otherwise
+	/// Lets callers copy straight from the mapping instead of reading into an intermediate buffer
+	const u8* GetMappedBlock(u32 sector);
+	/// Speculatively reads the given sectors, so that a later read of them completes without waiting
+	void Prefetch(u32 sector, u32 count);
 	int FinishRead();
 	void CancelRead();
 	void Close();
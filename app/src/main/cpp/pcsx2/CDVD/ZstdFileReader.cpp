@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "CDVD/ZstdFileReader.h"
+#include "CDVD/ZstdSeekable.h"
+
+#include "common/Assertions.h"
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+
+#include "fmt/format.h"
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+
+ZstdFileReader::ZstdFileReader() = default;
+
+ZstdFileReader::~ZstdFileReader()
+{
+	pxAssert(!m_src);
+}
+
+bool ZstdFileReader::Open2(std::string filename, Error* error)
+{
+	Close2();
+	m_filename = std::move(filename);
+	m_src = FileSystem::OpenCFile(m_filename.c_str(), "rb", error);
+	if (!m_src || !ReadSeekTable(error))
+	{
+		Close2();
+		return false;
+	}
+
+	for (DecodeContext& ctx : m_decodeContexts)
+	{
+		ctx.dctx = ZSTD_createDCtx();
+		if (!ctx.dctx)
+		{
+			Error::SetString(error, "Failed to create zstd decompression context.");
+			Close2();
+			return false;
+		}
+
+		ctx.readBuffer = std::make_unique_for_overwrite<u8[]>(m_maxCompressedSize);
+	}
+
+	return true;
+}
+
+bool ZstdFileReader::ReadSeekTable(Error* error)
+{
+	using namespace ZstdSeekable;
+
+	const s64 file_size = FileSystem::FSize64(m_src);
+	Footer footer;
+	if (file_size < static_cast<s64>(sizeof(SkippableHeader) + sizeof(Footer)) ||
+		FileSystem::FSeek64(m_src, file_size - sizeof(Footer), SEEK_SET) != 0 ||
+		std::fread(&footer, sizeof(footer), 1, m_src) != 1)
+	{
+		Error::SetString(error, "Failed to read zstd seek table footer.");
+		return false;
+	}
+
+	if (footer.magic != SEEKABLE_MAGIC || (footer.descriptor & RESERVED_MASK) != 0)
+	{
+		Error::SetString(error, "File is not a zstd seekable format image. Convert it with pcsx2-isoconv.");
+		return false;
+	}
+
+	if (footer.num_frames == 0 || footer.num_frames > MAX_FRAMES)
+	{
+		Error::SetStringFmt(error, "Invalid zstd seek table frame count {}.", footer.num_frames);
+		return false;
+	}
+
+	const u32 entry_size = sizeof(Entry) + ((footer.descriptor & CHECKSUM_FLAG) ? sizeof(u32) : 0);
+	const u64 table_size = static_cast<u64>(footer.num_frames) * entry_size + sizeof(Footer);
+	const s64 table_start = file_size - static_cast<s64>(table_size + sizeof(SkippableHeader));
+
+	SkippableHeader header;
+	if (table_start < 0 || FileSystem::FSeek64(m_src, table_start, SEEK_SET) != 0 ||
+		std::fread(&header, sizeof(header), 1, m_src) != 1 || header.magic != SKIPPABLE_MAGIC || header.size != table_size)
+	{
+		Error::SetString(error, "zstd seek table is corrupted.");
+		return false;
+	}
+
+	std::vector<u8> entries(static_cast<size_t>(footer.num_frames) * entry_size);
+	if (std::fread(entries.data(), entries.size(), 1, m_src) != 1)
+	{
+		Error::SetString(error, "Failed to read zstd seek table.");
+		return false;
+	}
+
+	m_frames.resize(footer.num_frames);
+	u64 file_offset = 0;
+	u64 offset = 0;
+	for (u32 i = 0; i < footer.num_frames; i++)
+	{
+		Entry entry;
+		std::memcpy(&entry, &entries[static_cast<size_t>(i) * entry_size], sizeof(entry));
+		if (entry.compressed_size == 0 || entry.decompressed_size == 0 || entry.decompressed_size > MAX_FRAME_SIZE ||
+			entry.compressed_size > ZSTD_compressBound(MAX_FRAME_SIZE))
+		{
+			Error::SetStringFmt(error, "zstd seek table entry {} is invalid.", i);
+			return false;
+		}
+
+		m_frames[i] = {file_offset, offset, entry.compressed_size, entry.decompressed_size};
+		m_maxCompressedSize = std::max(m_maxCompressedSize, entry.compressed_size);
+		file_offset += entry.compressed_size;
+		offset += entry.decompressed_size;
+	}
+
+	if (file_offset > static_cast<u64>(table_start))
+	{
+		Error::SetString(error, "zstd seek table describes more data than the file contains.");
+		return false;
+	}
+
+	m_totalSize = offset;
+
+	// Images written by the converter use one frame size throughout, which turns lookups into a division.
+	m_frameSize = m_frames[0].size;
+	for (u32 i = 1; i < footer.num_frames; i++)
+	{
+		const bool last = (i == footer.num_frames - 1);
+		if (last ? (m_frames[i].size > m_frameSize) : (m_frames[i].size != m_frameSize))
+		{
+			m_frameSize = 0;
+			break;
+		}
+	}
+
+	DevCon.WriteLn(fmt::format("zstd seekable image: {} frames, {} bytes, {}.", m_frames.size(), m_totalSize,
+		m_frameSize ? fmt::format("{} byte frames", m_frameSize) : std::string("variable frame size")));
+	return true;
+}
+
+bool ZstdFileReader::Precache2(ProgressCallback* progress, Error* error)
+{
+	if (!m_src)
+		return false;
+
+	const s64 size = FileSystem::FSize64(m_src);
+	if (size < 0 || !CheckAvailableMemoryForPrecaching(static_cast<u64>(size), error))
+		return false;
+
+	m_file_cache_size = static_cast<size_t>(size);
+	m_file_cache = std::make_unique_for_overwrite<u8[]>(m_file_cache_size);
+	if (FileSystem::FSeek64(m_src, 0, SEEK_SET) != 0 ||
+		FileSystem::ReadFileWithProgress(
+			m_src, m_file_cache.get(), m_file_cache_size, progress, error) != m_file_cache_size)
+	{
+		m_file_cache.reset();
+		return false;
+	}
+
+	for (DecodeContext& ctx : m_decodeContexts)
+		ctx.readBuffer.reset();
+	std::fclose(m_src);
+	m_src = nullptr;
+	return true;
+}
+
+void ZstdFileReader::Close2()
+{
+	m_filename.clear();
+
+	if (m_src)
+	{
+		std::fclose(m_src);
+		m_src = nullptr;
+	}
+	if (m_file_cache)
+		m_file_cache.reset();
+
+	for (DecodeContext& ctx : m_decodeContexts)
+	{
+		if (ctx.dctx)
+		{
+			ZSTD_freeDCtx(ctx.dctx);
+			ctx.dctx = nullptr;
+		}
+		ctx.readBuffer.reset();
+	}
+
+	m_frames.clear();
+	m_frameSize = 0;
+	m_maxCompressedSize = 0;
+	m_totalSize = 0;
+}
+
+u32 ZstdFileReader::GetBlockCount() const
+{
+	return static_cast<u32>((m_totalSize - m_dataoffset) / m_blocksize);
+}
+
+ThreadedFileReader::Chunk ZstdFileReader::ChunkForOffset(u64 offset)
+{
+	Chunk chunk = {0};
+	if (offset >= m_totalSize)
+	{
+		chunk.chunkID = -1;
+		return chunk;
+	}
+
+	size_t frame;
+	if (m_frameSize)
+	{
+		frame = static_cast<size_t>(offset / m_frameSize);
+	}
+	else
+	{
+		const auto it = std::upper_bound(m_frames.begin(), m_frames.end(), offset,
+			[](u64 pos, const Frame& f) { return pos < f.offset; });
+		frame = static_cast<size_t>(std::distance(m_frames.begin(), it)) - 1;
+	}
+
+	chunk.chunkID = static_cast<s64>(frame);
+	chunk.offset = m_frames[frame].offset;
+	chunk.length = m_frames[frame].size;
+	return chunk;
+}
+
+int ZstdFileReader::ReadChunk(void* dst, s64 chunkID)
+{
+	if (chunkID < 0)
+		return -1;
+
+	return ReadFrame(dst, static_cast<u32>(chunkID), m_decodeContexts[0]);
+}
+
+u32 ZstdFileReader::GetParallelDecodeSlots() const
+{
+	return PARALLEL_DECODE_SLOTS;
+}
+
+int ZstdFileReader::ReadChunkParallel(void* dst, s64 chunkID, u32 slot)
+{
+	if (chunkID < 0)
+		return -1;
+
+	pxAssert(slot < PARALLEL_DECODE_SLOTS);
+	return ReadFrame(dst, static_cast<u32>(chunkID), m_decodeContexts[slot + 1]);
+}
+
+int ZstdFileReader::ReadFrame(void* dst, u32 frame, DecodeContext& ctx)
+{
+	if (frame >= m_frames.size())
+		return -1;
+
+	const Frame& f = m_frames[frame];
+	const u8* src;
+	if (m_file_cache)
+	{
+		if (f.file_offset + f.compressed_size > m_file_cache_size)
+			return 0;
+
+		src = &m_file_cache[f.file_offset];
+	}
+	else
+	{
+		std::unique_lock lock(m_srcMutex);
+		if (FileSystem::FSeek64(m_src, f.file_offset, SEEK_SET) != 0 ||
+			std::fread(ctx.readBuffer.get(), f.compressed_size, 1, m_src) != 1)
+		{
+			Console.Error(fmt::format("Unable to read zstd frame {}.", frame));
+			return 0;
+		}
+
+		src = ctx.readBuffer.get();
+	}
+
+	const size_t result = ZSTD_decompressDCtx(ctx.dctx, dst, f.size, src, f.compressed_size);
+	if (ZSTD_isError(result) || result != f.size)
+	{
+		Console.Error(fmt::format("Unable to decompress zstd frame {}: {}", frame,
+			ZSTD_isError(result) ? ZSTD_getErrorName(result) : "size mismatch"));
+		return 0;
+	}
+
+	return static_cast<int>(f.size);
+}
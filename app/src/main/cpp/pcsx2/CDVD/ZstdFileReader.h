@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "CDVD/ThreadedFileReader.h"
+
+#include <array>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+
+/// Reader for zstd seekable format images (.iso.zst), see ZstdSeekable.h.
+/// Every frame is a chunk, decoded in parallel by the ThreadedFileReader decode pool.
+class ZstdFileReader final : public ThreadedFileReader
+{
+	DeclareNoncopyableObject(ZstdFileReader);
+
+public:
+	ZstdFileReader();
+	~ZstdFileReader() override;
+
+	bool Open2(std::string filename, Error* error) override;
+
+	bool Precache2(ProgressCallback* progress, Error* error) override;
+
+	Chunk ChunkForOffset(u64 offset) override;
+	int ReadChunk(void* dst, s64 chunkID) override;
+	u32 GetParallelDecodeSlots() const override;
+	int ReadChunkParallel(void* dst, s64 chunkID, u32 slot) override;
+
+	void Close2() override;
+
+	u32 GetBlockCount() const override;
+
+private:
+	static constexpr u32 PARALLEL_DECODE_SLOTS = 4;
+
+	struct Frame
+	{
+		/// Position of the compressed frame in the file
+		u64 file_offset;
+		/// Position of the frame's data in the decompressed image
+		u64 offset;
+		u32 compressed_size;
+		u32 size;
+	};
+
+	struct DecodeContext
+	{
+		ZSTD_DCtx* dctx = nullptr;
+		std::unique_ptr<u8[]> readBuffer;
+	};
+
+	bool ReadSeekTable(Error* error);
+	int ReadFrame(void* dst, u32 frame, DecodeContext& ctx);
+
+	std::vector<Frame> m_frames;
+	/// Size of every frame but the last one, zero if the sizes vary and lookups have to search
+	u32 m_frameSize = 0;
+	u32 m_maxCompressedSize = 0;
+	u64 m_totalSize = 0;
+
+	// Context 0 belongs to ReadChunk(), the others to the parallel decode slots.
+	std::array<DecodeContext, PARALLEL_DECODE_SLOTS + 1> m_decodeContexts;
+
+	std::FILE* m_src = nullptr;
+	// Serializes seeking and reading m_src between decode threads.
+	std::mutex m_srcMutex;
+	std::unique_ptr<u8[]> m_file_cache;
+	size_t m_file_cache_size = 0;
+};
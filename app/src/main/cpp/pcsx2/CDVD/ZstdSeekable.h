@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+/// Layout of zstd seekable format images, as described in zstd's contrib/seekable_format.
+/// The image is a sequence of independent zstd frames followed by a skippable frame holding the seek table:
+///   [frame 0] ... [frame N-1] [SKIPPABLE_MAGIC] [table size] [entries] [footer]
+/// Each entry stores the compressed and decompressed size of one frame, optionally followed by a checksum.
+namespace ZstdSeekable
+{
+	static constexpr u32 SKIPPABLE_MAGIC = 0x184D2A5E;
+	static constexpr u32 SEEKABLE_MAGIC = 0x8F92EAB1;
+	/// Set in Footer::descriptor when entries carry a checksum
+	static constexpr u8 CHECKSUM_FLAG = 0x80;
+	/// Bits 2-6 of the descriptor are reserved and must be zero
+	static constexpr u8 RESERVED_MASK = 0x7C;
+
+	/// Limits which keep a corrupt table from making us allocate huge buffers
+	static constexpr u32 MAX_FRAME_SIZE = 4 * 1024 * 1024;
+	static constexpr u32 MAX_FRAMES = 0x8000000;
+
+	/// Frame size used by the converter, large enough to compress well while keeping seeks cheap to decode
+	static constexpr u32 DEFAULT_FRAME_SIZE = 256 * 1024;
+
+#pragma pack(push, 1)
+	struct SkippableHeader
+	{
+		u32 magic;
+		/// Size of the entries plus the footer
+		u32 size;
+	};
+
+	struct Entry
+	{
+		u32 compressed_size;
+		u32 decompressed_size;
+	};
+
+	struct Footer
+	{
+		u32 num_frames;
+		u8 descriptor;
+		u32 magic;
+	};
+#pragma pack(pop)
+
+	static_assert(sizeof(SkippableHeader) == 8 && sizeof(Entry) == 8 && sizeof(Footer) == 9);
+} // namespace ZstdSeekable
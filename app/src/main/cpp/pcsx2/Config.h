@@ -187,6 +187,7 @@ enum class SpeedHack
 	InstantVU1,
 	MTVU,
 	EECycleRate,
+	FMVFastPath,
 	MaxCount,
 };
 
@@ -753,6 +754,7 @@ struct Pcsx2Config
 					DumpTexturesWithFMVActive : 1,
 					DumpDirectTextures : 1,
 					DumpPaletteTextures : 1,
+					DumpTexturesZstd : 1,
 					LoadTextureReplacements : 1,
 					LoadTextureReplacementsAsync : 1,
 					PrecacheTextureReplacements : 1,
@@ -1052,7 +1054,8 @@ struct Pcsx2Config
 			WaitLoop : 1, // enables constant loop detection and fast-forwarding
 			vuFlagHack : 1, // microVU specific flag hack
 			vuThread : 1, // Enable Threaded VU1
-			vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+			vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+			fmvFastPath : 1; // Write decoded IPU macroblocks straight to the IPU0 DMA destination
 		BITFIELD_END
 
 		s8 EECycleRate; // EE cycle rate selector (1.0, 1.5, 2.0)
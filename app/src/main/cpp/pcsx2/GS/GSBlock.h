@@ -30,7 +30,7 @@ class GSBlock
 	static const GSVector4i m_uw8hmask2;
 	static const GSVector4i m_uw8hmask3;
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 	// Equvialent of `a = *s0; b = *s1; sw128(a, b);`
 	// Loads in two halves instead to reduce shuffle instructions
 	// Especially good for Zen/Zen+, as it's replacing a very expensive vperm2i128
@@ -51,7 +51,7 @@ public:
 		const u8* RESTRICT s0 = &src[srcpitch * 0];
 		const u8* RESTRICT s1 = &src[srcpitch * 1];
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		GSVector8i v0 = GSVector8i::load<false>(s0).acbd();
 		GSVector8i v1 = GSVector8i::load<false>(s1).acbd();
@@ -115,7 +115,7 @@ public:
 
 		// for(int j = 0; j < 16; j++) {((u16*)s0)[j] = columnTable16[0][j]; ((u16*)s1)[j] = columnTable16[1][j];}
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		GSVector8i v0, v1;
 
@@ -179,7 +179,7 @@ public:
 	{
 		// TODO: read unaligned as WriteColumn32 does and try saving a few shuffles
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		GSVector4i v4 = GSVector4i::load<false>(&src[srcpitch * 0]);
 		GSVector4i v5 = GSVector4i::load<false>(&src[srcpitch * 1]);
@@ -242,7 +242,7 @@ public:
 
 		// TODO: pshufb
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		GSVector8i v0 = GSVector8i(GSVector4i::load<false>(&src[srcpitch * 0]), GSVector4i::load<false>(&src[srcpitch * 1]));
 		GSVector8i v1 = GSVector8i(GSVector4i::load<false>(&src[srcpitch * 2]), GSVector4i::load<false>(&src[srcpitch * 3]));
@@ -401,7 +401,7 @@ public:
 	template <int i>
 	__forceinline static void ReadColumn32(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -438,7 +438,7 @@ public:
 	template <int i>
 	__forceinline static void ReadColumn16(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -480,7 +480,7 @@ public:
 
 		//for(int j = 0; j < 64; j++) ((u8*)src)[j] = (u8)j;
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -550,7 +550,7 @@ public:
 	{
 		//printf("ReadColumn4\n");
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -716,7 +716,7 @@ public:
 	{
 		//printf("ReadBlock4P\n");
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -827,7 +827,7 @@ public:
 	template <u32 shift, u32 mask>
 	__forceinline static void ReadBlockHP(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -951,7 +951,7 @@ public:
 	template <bool AEM>
 	static void ExpandBlock24(const u32* RESTRICT src, u8* RESTRICT dst, int dstpitch, const GIFRegTEXA& TEXA)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -999,7 +999,7 @@ public:
 	template <bool AEM>
 	static void ExpandBlock16(const u16* RESTRICT src, u8* RESTRICT dst, int dstpitch, const GIFRegTEXA& TEXA) // do not inline, uses too many xmm regs
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -1146,7 +1146,7 @@ public:
 
 	__forceinline static void UnpackAndWriteBlock24(const u8* RESTRICT src, int srcpitch, u8* RESTRICT dst)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const u8* RESTRICT s0 = &src[srcpitch * 0];
 		const u8* RESTRICT s1 = &src[srcpitch * 1];
@@ -1236,7 +1236,7 @@ public:
 	{
 		GSVector4i v4, v5, v6, v7;
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		GSVector8i* d = reinterpret_cast<GSVector8i*>(dst);
 
@@ -1382,7 +1382,7 @@ public:
 	template <bool AEM>
 	__forceinline static void ReadAndExpandBlock24(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch, const GIFRegTEXA& TEXA)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -1459,7 +1459,7 @@ public:
 	template <bool AEM>
 	__forceinline static void ReadAndExpandBlock16(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch, const GIFRegTEXA& TEXA)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -1529,7 +1529,7 @@ public:
 	{
 		//printf("ReadAndExpandBlock8_32\n");
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -1671,7 +1671,7 @@ public:
 	{
 		//printf("ReadAndExpandBlock4_32\n");
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -1822,7 +1822,7 @@ public:
 	{
 		//printf("ReadAndExpandBlock8H_32\n");
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 		for (int i = 0; i < 4; i++)
@@ -1851,7 +1851,7 @@ public:
 	template <u32 shift, u32 mask>
 	__forceinline static void ReadAndExpandBlock4H_32(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch, const u32* RESTRICT pal)
 	{
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 
 		const GSVector8i* s = (const GSVector8i*)src;
 
@@ -6,6 +6,7 @@
 #include "GS/GSLocalMemory.h"
 #include "GS/GSGL.h"
 #include "GS/GSUtil.h"
+#include "GS/GSXXH.h"
 #include "GS/Renderers/Common/GSDevice.h"
 #include "GS/Renderers/Common/GSRenderer.h"
 #include "common/AlignedMalloc.h"
@@ -134,6 +135,17 @@ void GSClut::Reset()
 	m_write.dirty = 1;
 	m_read = {};
 	m_read.dirty = true;
+	InvalidateExpandedCache();
+}
+
+void GSClut::InvalidateExpandedCache()
+{
+	for (ExpandedCLUT8& e : m_expanded8)
+		e.valid = false;
+	for (ExpandedCLUT4& e : m_expanded4)
+		e.valid = false;
+
+	m_current_expanded = nullptr;
 }
 
 bool GSClut::InvalidateRange(u32 start_block, u32 end_block, bool is_draw)
@@ -368,6 +380,7 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 		m_read.TEXA = TEXA;
 		m_read.dirty = false;
 		m_read.adirty = true;
+		m_current_expanded = nullptr;
 
 		u16* clut = m_clut;
 
@@ -383,9 +396,7 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 				case PSMT4HL:
 				case PSMT4HH:
 					clut += (TEX0.CSA & 15) << 4;
-					// TODO: merge these functions
-					ReadCLUT_T32_I4(clut, m_buff32);
-					ExpandCLUT64_T32_I8(m_buff32, (u64*)m_buff64); // sw renderer does not need m_buff64 anymore
+					ReadCachedCLUT_I4(clut, true, TEXA);
 					break;
 			}
 		}
@@ -396,15 +407,13 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 				case PSMT8:
 				case PSMT8H:
 					clut += TEX0.CSA << 4;
-					Expand16(clut, m_buff32, 256, TEXA);
+					ReadCachedCLUT16_I8(clut, TEXA);
 					break;
 				case PSMT4:
 				case PSMT4HL:
 				case PSMT4HH:
 					clut += TEX0.CSA << 4;
-					// TODO: merge these functions
-					Expand16(clut, m_buff32, 16, TEXA);
-					ExpandCLUT64_T32_I8(m_buff32, (u64*)m_buff64); // sw renderer does not need m_buff64 anymore
+					ReadCachedCLUT_I4(clut, false, TEXA);
 					break;
 			}
 		}
@@ -469,13 +478,36 @@ void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 	{
 		m_read.adirty = false;
 
-		if (GSLocalMemory::m_psm[m_read.TEX0.CPSM].trbpp == 24 && m_read.TEXA.AEM == 0)
+		if (m_current_expanded && m_current_expanded->avalid)
+		{
+			m_read.amin = m_current_expanded->amin;
+			m_read.amax = m_current_expanded->amax;
+		}
+		else if (GSLocalMemory::m_psm[m_read.TEX0.CPSM].trbpp == 24 && m_read.TEXA.AEM == 0)
 		{
 			m_read.amin = m_read.TEXA.TA0;
 			m_read.amax = m_read.TEXA.TA0;
 		}
 		else
 		{
+#if defined(_M_ARM64)
+			// LD4 gathers the alpha bytes of 16 colours into one register, leaving a plain min/max reduction.
+			const u32 count = GSLocalMemory::m_psm[m_read.TEX0.PSM].pal;
+			pxAssert(count == 16 || count == 256);
+
+			uint8x16_t amin = vdupq_n_u8(0xff);
+			uint8x16_t amax = vdupq_n_u8(0);
+
+			for (u32 i = 0; i < count; i += 16)
+			{
+				const uint8x16_t a = vld4q_u8(reinterpret_cast<const u8*>(&m_buff32[i])).val[3];
+				amin = vminq_u8(amin, a);
+				amax = vmaxq_u8(amax, a);
+			}
+
+			m_read.amin = vminvq_u8(amin);
+			m_read.amax = vmaxvq_u8(amax);
+#else
 			const GSVector4i* p = (const GSVector4i*)m_buff32;
 
 			GSVector4i amin, amax;
@@ -519,6 +551,14 @@ void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 
 			m_read.amin = v0.min_i16(v1).extract16<0>();
 			m_read.amax = v0.max_i16(v1).extract16<1>();
+#endif
+
+			if (m_current_expanded)
+			{
+				m_current_expanded->amin = m_read.amin;
+				m_current_expanded->amax = m_read.amax;
+				m_current_expanded->avalid = true;
+			}
 		}
 	}
 
@@ -526,8 +566,121 @@ void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 	amax_out = m_read.amax;
 }
 
+/// Finds the cache entry holding the expansion of hash/key, or returns null and picks the slot to replace.
+template <typename T, size_t N>
+static T* FindExpandedCLUT(T (&cache)[N], u64 hash, u64 key, u32& use_counter, T*& victim)
+{
+	victim = &cache[0];
+	for (T& e : cache)
+	{
+		if (e.valid && e.hash == hash && e.key == key)
+		{
+			e.last_use = ++use_counter;
+			return &e;
+		}
+
+		// Prefer empty slots, then the least recently used one.
+		if (victim->valid && (!e.valid || e.last_use < victim->last_use))
+			victim = &e;
+	}
+
+	return nullptr;
+}
+
+template <typename T>
+static void StoreExpandedCLUT(T* entry, u64 hash, u64 key, u32& use_counter)
+{
+	entry->hash = hash;
+	entry->key = key;
+	entry->last_use = ++use_counter;
+	entry->valid = true;
+	entry->avalid = false;
+}
+
+// The 16-bit expansion only depends on the palette itself and the TEXA alpha fields.
+static constexpr u64 texa16_mask = 0xFF000080FFull; // TA1 AEM TA0
+
+void GSClut::ReadCachedCLUT16_I8(const u16* RESTRICT clut, const GIFRegTEXA& TEXA)
+{
+	const u64 key = TEXA.U64 & texa16_mask;
+	const u64 hash = GSXXH3_64bits(clut, 256 * sizeof(u16));
+
+	ExpandedCLUT8* entry;
+	if (ExpandedCLUT8* hit = FindExpandedCLUT(m_expanded8, hash, key, m_expanded_use_counter, entry))
+	{
+		std::memcpy(m_buff32, hit->buff32, sizeof(hit->buff32));
+		m_current_expanded = hit;
+		return;
+	}
+
+	Expand16(clut, m_buff32, 256, TEXA);
+
+	std::memcpy(entry->buff32, m_buff32, sizeof(entry->buff32));
+	StoreExpandedCLUT(entry, hash, key, m_expanded_use_counter);
+	m_current_expanded = entry;
+}
+
+void GSClut::ReadCachedCLUT_I4(const u16* RESTRICT clut, bool is32, const GIFRegTEXA& TEXA)
+{
+	// 32-bit palettes ignore TEXA, the top key bit keeps them apart from 16-bit ones with the same halfwords.
+	const u64 key = is32 ? (1ull << 63) : (TEXA.U64 & texa16_mask);
+
+	u64 hash;
+	if (is32)
+	{
+		// The high halves live 256 entries after the low ones.
+		alignas(16) u16 planes[32];
+		std::memcpy(&planes[0], clut, 16 * sizeof(u16));
+		std::memcpy(&planes[16], clut + 256, 16 * sizeof(u16));
+		hash = GSXXH3_64bits(planes, sizeof(planes));
+	}
+	else
+	{
+		hash = GSXXH3_64bits(clut, 16 * sizeof(u16));
+	}
+
+	ExpandedCLUT4* entry;
+	if (ExpandedCLUT4* hit = FindExpandedCLUT(m_expanded4, hash, key, m_expanded_use_counter, entry))
+	{
+		std::memcpy(m_buff32, hit->buff32, sizeof(hit->buff32));
+		std::memcpy(m_buff64, hit->buff64, sizeof(hit->buff64));
+		m_current_expanded = hit;
+		return;
+	}
+
+	if (is32)
+		ReadCLUT_T32_I4(clut, m_buff32);
+	else
+		Expand16(clut, m_buff32, 16, TEXA);
+
+	ExpandCLUT64_T32_I8(m_buff32, m_buff64); // sw renderer does not need m_buff64 anymore
+
+	std::memcpy(entry->buff32, m_buff32, sizeof(entry->buff32));
+	std::memcpy(entry->buff64, m_buff64, sizeof(entry->buff64));
+	StoreExpandedCLUT(entry, hash, key, m_expanded_use_counter);
+	m_current_expanded = entry;
+}
+
 //
 
+#if defined(_M_ARM64)
+
+/// Splits 16 consecutive 32-bit words of a CLUT block column into the four halfword vectors the CLUT stores.
+/// LD2 on 64-bit lanes separates the even and odd word pairs and UZP then separates low and high halves,
+/// two instructions per output in place of the three rounds of zips the generic path needs.
+static __forceinline void DeinterleaveCLUTColumn(const void* src, uint16x8_t& v0, uint16x8_t& v1, uint16x8_t& v2, uint16x8_t& v3)
+{
+	const uint64x2x2_t s0 = vld2q_u64(static_cast<const u64*>(src));
+	const uint64x2x2_t s1 = vld2q_u64(static_cast<const u64*>(src) + 4);
+
+	v0 = vuzp1q_u16(vreinterpretq_u16_u64(s0.val[0]), vreinterpretq_u16_u64(s1.val[0]));
+	v1 = vuzp1q_u16(vreinterpretq_u16_u64(s0.val[1]), vreinterpretq_u16_u64(s1.val[1]));
+	v2 = vuzp2q_u16(vreinterpretq_u16_u64(s0.val[0]), vreinterpretq_u16_u64(s1.val[0]));
+	v3 = vuzp2q_u16(vreinterpretq_u16_u64(s0.val[1]), vreinterpretq_u16_u64(s1.val[1]));
+}
+
+#endif
+
 void GSClut::WriteCLUT_T32_I8_CSM1(const u32* RESTRICT src, u16* RESTRICT clut, u16 offset)
 {
 	// This is required when CSA is offset from the base of the CLUT so we point to the right data
@@ -560,6 +713,16 @@ __forceinline void GSClut::WriteCLUT_T32_I4_CSM1(const u32* RESTRICT src, u16* R
 	d[0] = v0;
 	d[16] = v1;
 
+#elif defined(_M_ARM64)
+
+	uint16x8_t v0, v1, v2, v3;
+	DeinterleaveCLUTColumn(src, v0, v1, v2, v3);
+
+	vst1q_u16(clut + 0, v0);
+	vst1q_u16(clut + 8, v1);
+	vst1q_u16(clut + 256, v2);
+	vst1q_u16(clut + 264, v3);
+
 #else
 
 	GSVector4i* s = (GSVector4i*)src;
@@ -586,6 +749,21 @@ void GSClut::WriteCLUT_T16_I8_CSM1(const u16* RESTRICT src, u16* RESTRICT clut)
 {
 	// 2 blocks
 
+#if defined(_M_ARM64)
+
+	for (int i = 0; i < 256; i += 32)
+	{
+		uint16x8_t v0, v1, v2, v3;
+		DeinterleaveCLUTColumn(&src[i], v0, v1, v2, v3);
+
+		vst1q_u16(&clut[i + 0], v0);
+		vst1q_u16(&clut[i + 8], v1);
+		vst1q_u16(&clut[i + 16], v2);
+		vst1q_u16(&clut[i + 24], v3);
+	}
+
+#else
+
 	GSVector4i* s = (GSVector4i*)src;
 	GSVector4i* d = (GSVector4i*)clut;
 
@@ -605,6 +783,8 @@ void GSClut::WriteCLUT_T16_I8_CSM1(const u16* RESTRICT src, u16* RESTRICT clut)
 		d[i + 2] = v1;
 		d[i + 3] = v3;
 	}
+
+#endif
 }
 
 __forceinline void GSClut::WriteCLUT_T16_I4_CSM1(const u16* RESTRICT src, u16* RESTRICT clut)
@@ -634,6 +814,20 @@ void GSClut::ReadCLUT_T32_I8(const u16* RESTRICT clut, u32* RESTRICT dst, int of
 
 __forceinline void GSClut::ReadCLUT_T32_I4(const u16* RESTRICT clut, u32* RESTRICT dst)
 {
+#if defined(_M_ARM64)
+
+	// Rebuilding the colours is a plain interleave of the low and high planes, which ST2 does while storing.
+	uint16x8x2_t v0, v1;
+	v0.val[0] = vld1q_u16(clut + 0);
+	v0.val[1] = vld1q_u16(clut + 256);
+	v1.val[0] = vld1q_u16(clut + 8);
+	v1.val[1] = vld1q_u16(clut + 264);
+
+	vst2q_u16(reinterpret_cast<u16*>(dst), v0);
+	vst2q_u16(reinterpret_cast<u16*>(dst + 8), v1);
+
+#else
+
 	GSVector4i* s = (GSVector4i*)clut;
 	GSVector4i* d = (GSVector4i*)dst;
 
@@ -648,6 +842,8 @@ __forceinline void GSClut::ReadCLUT_T32_I4(const u16* RESTRICT clut, u32* RESTRI
 	d[1] = v1;
 	d[2] = v2;
 	d[3] = v3;
+
+#endif
 }
 
 #if 0
@@ -823,6 +1019,36 @@ constinit const GSVector4i GSClut::m_rm = GSVector4i::cxpr(0x0000001f);
 
 void GSClut::Expand16(const u16* RESTRICT src, u32* RESTRICT dst, int w, const GIFRegTEXA& TEXA)
 {
+#if defined(_M_ARM64)
+
+	// Narrowing shifts move each 5-bit channel into its own byte plane, ST4 interleaves them back to RGBA8.
+	pxAssert((w & 15) == 0);
+
+	const uint8x16_t ta0 = vdupq_n_u8(TEXA.TA0);
+	const uint8x16_t ta1 = vdupq_n_u8(TEXA.TA1);
+
+	for (int i = 0; i < w; i += 16)
+	{
+		const uint16x8_t c0 = vld1q_u16(&src[i + 0]);
+		const uint16x8_t c1 = vld1q_u16(&src[i + 8]);
+		const uint8x16_t lo = vcombine_u8(vmovn_u16(c0), vmovn_u16(c1));
+		const uint8x16_t mid = vcombine_u8(vshrn_n_u16(c0, 5), vshrn_n_u16(c1, 5));
+		const uint8x16_t hi = vcombine_u8(vshrn_n_u16(c0, 8), vshrn_n_u16(c1, 8));
+
+		uint8x16x4_t v;
+		v.val[0] = vshlq_n_u8(lo, 3);
+		v.val[1] = vshlq_n_u8(mid, 3);
+		v.val[2] = vshlq_n_u8(vshrq_n_u8(hi, 2), 3);
+		v.val[3] = vbslq_u8(vtstq_u8(hi, vdupq_n_u8(0x80)), ta1, ta0);
+
+		if (TEXA.AEM)
+			v.val[3] = vbicq_u8(v.val[3], vcombine_u8(vmovn_u16(vceqzq_u16(c0)), vmovn_u16(vceqzq_u16(c1))));
+
+		vst4q_u8(reinterpret_cast<u8*>(&dst[i]), v);
+	}
+
+#else
+
 	pxAssert((w & 7) == 0);
 
 	const GSVector4i rm = m_rm;
@@ -859,6 +1085,8 @@ void GSClut::Expand16(const u16* RESTRICT src, u32* RESTRICT dst, int w, const G
 			d[i * 2 + 1] = ((ch & rm) << 3) | ((ch & gm) << 6) | ((ch & bm) << 9) | TA0.blend8(TA1, ch.sra16<15>()).andnot(ch == GSVector4i::zero());
 		}
 	}
+
+#endif
 }
 
 bool GSClut::WriteState::IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
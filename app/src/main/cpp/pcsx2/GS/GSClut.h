@@ -46,6 +46,38 @@ class alignas(32) GSClut final : public GSAlignedClass<32>
 		bool IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 	} m_read = {};
 
+	/// Recently expanded palettes. Games commonly reload the same palette before every draw, and the TEXA
+	/// expansion, the 2KB pair table of 4-bit palettes and the alpha scan would otherwise be redone each time.
+	/// 32-bit 8-bit-indexed palettes are not kept, hashing the whole 1KB CLUT plus copying the result back
+	/// costs more than splitting the halfword planes back out.
+	struct ExpandedCLUT
+	{
+		u64 hash;
+		u64 key;
+		u32 last_use;
+		int amin, amax;
+		bool valid;
+		bool avalid;
+	};
+
+	struct alignas(32) ExpandedCLUT8 : ExpandedCLUT
+	{
+		u32 buff32[256];
+	};
+
+	struct alignas(32) ExpandedCLUT4 : ExpandedCLUT
+	{
+		u32 buff32[16];
+		u64 buff64[256];
+	};
+
+	static constexpr u32 EXPANDED_CLUT_CACHE_SIZE = 8;
+
+	ExpandedCLUT8 m_expanded8[EXPANDED_CLUT_CACHE_SIZE] = {};
+	ExpandedCLUT4 m_expanded4[EXPANDED_CLUT_CACHE_SIZE] = {};
+	ExpandedCLUT* m_current_expanded = nullptr;
+	u32 m_expanded_use_counter = 0;
+
 	GSTexture* m_gpu_clut4 = nullptr;
 	GSTexture* m_gpu_clut8 = nullptr;
 	GSTexture* m_current_gpu_clut = nullptr;
@@ -92,6 +124,12 @@ private:
 
 	static void Expand16(const u16* RESTRICT src, u32* RESTRICT dst, int w, const GIFRegTEXA& TEXA);
 
+	/// Expands a 256 entry 16-bit palette into m_buff32, reusing a previous expansion of the same data if possible.
+	void ReadCachedCLUT16_I8(const u16* RESTRICT clut, const GIFRegTEXA& TEXA);
+	/// Expands a 16 entry palette into m_buff32 and m_buff64, reusing a previous expansion of the same data if possible.
+	void ReadCachedCLUT_I4(const u16* RESTRICT clut, bool is32, const GIFRegTEXA& TEXA);
+	void InvalidateExpandedCache();
+
 public:
 	GSClut(GSLocalMemory* mem);
 	~GSClut();
@@ -10,12 +10,18 @@
 #include "common/FileSystem.h"
 #include "common/HeapArray.h"
 #include "common/ScopedGuard.h"
+#include "common/Threading.h"
 
 #include <7zCrc.h>
 #include <XzCrc64.h>
 #include <XzEnc.h>
 #include <zstd.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 GSDumpBase::GSDumpBase(std::string fn)
 	: m_filename(std::move(fn))
 	, m_frames(0)
@@ -100,6 +106,8 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	AppendRawData(1);
 	AppendRawData(static_cast<u8>(field));
 
+	EndFrame();
+
 	if (last)
 		m_extra_frames--;
 
@@ -318,16 +326,50 @@ namespace
 		std::vector<u8> m_in_buff;
 		std::vector<u8> m_out_buff;
 
+		u64 m_file_offset = 0;
+		u32 m_frame_count = 0;
+		GSDumpZstChunk m_chunk = {};
+		std::vector<GSDumpZstChunk> m_chunks;
+		std::vector<GSDumpZstKeyframe> m_keyframes;
+		u32 m_last_keyframe_frame = 0;
+
+		// Keyframes are compressed on a worker, and written out at the next chunk boundary.
+		struct PendingKeyframe
+		{
+			std::vector<u8> data;
+			u32 uncompressed_size;
+			u32 frame;
+			u32 chunk;
+			bool ok;
+		};
+
+		std::thread m_thread;
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		std::deque<PendingKeyframe> m_keyframe_queue;
+		std::deque<PendingKeyframe> m_keyframe_done;
+		bool m_shutdown = false;
+
 		void MayFlush();
 		void Compress(ZSTD_EndDirective action);
+		void WorkerThread();
+		void StopWorkerThread();
+		void WriteCompressedKeyframes();
 		void AppendRawData(const void* data, size_t size);
 		void AppendRawData(u8 c);
+		void EndFrame() override;
+
+		void WriteSkippableFrame(u32 index, const void* data, size_t size);
+		void WriteIndex();
 
 	public:
 		GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
 			u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
 			const freezeData& fd, const GSPrivRegSet* regs);
 		virtual ~GSDumpZst();
+
+		bool WantsKeyframe() const override;
+		void AddKeyframe(const freezeData& fd, const GSPrivRegSet* regs) override;
 	};
 
 	GSDumpZst::GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
@@ -344,6 +386,9 @@ namespace
 		m_out_buff.resize(_1mb);
 
 		AddHeader(serial, crc, screenshot_width, screenshot_height, screenshot_pixels, fd, regs);
+
+		// The header gets its own frame, so the packet chunks can be decoded without it.
+		Compress(ZSTD_e_end);
 	}
 
 	GSDumpZst::~GSDumpZst()
@@ -351,6 +396,11 @@ namespace
 		// Finish the stream
 		Compress(ZSTD_e_end);
 
+		// Anything still being compressed goes in front of the index.
+		StopWorkerThread();
+		WriteCompressedKeyframes();
+		WriteIndex();
+
 		ZSTD_freeCStream(m_strm);
 	}
 
@@ -368,6 +418,13 @@ namespace
 		MayFlush();
 	}
 
+	void GSDumpZst::EndFrame()
+	{
+		m_frame_count++;
+		if ((m_frame_count % GSDUMP_ZST_CHUNK_FRAMES) == 0)
+			Compress(ZSTD_e_end);
+	}
+
 	void GSDumpZst::MayFlush()
 	{
 		if (m_in_buff.size() >= _1mb)
@@ -376,7 +433,8 @@ namespace
 
 	void GSDumpZst::Compress(ZSTD_EndDirective action)
 	{
-		if (m_in_buff.empty())
+		// An empty buffer still has to close a frame which was partially flushed.
+		if (m_in_buff.empty() && (action != ZSTD_e_end || m_chunk.uncompressed_size == 0))
 			return;
 
 		ZSTD_inBuffer inbuf = {m_in_buff.data(), m_in_buff.size(), 0};
@@ -395,6 +453,8 @@ namespace
 			if (outbuf.pos > 0)
 			{
 				Write(m_out_buff.data(), outbuf.pos);
+				m_file_offset += outbuf.pos;
+				m_chunk.compressed_size += static_cast<u32>(outbuf.pos);
 				outbuf.pos = 0;
 			}
 
@@ -412,7 +472,161 @@ namespace
 			}
 		}
 
+		m_chunk.uncompressed_size += static_cast<u32>(m_in_buff.size());
 		m_in_buff.clear();
+
+		if (action == ZSTD_e_end)
+		{
+			m_chunks.push_back(m_chunk);
+			m_chunk = {};
+			m_chunk.file_offset = m_file_offset;
+			m_chunk.first_frame = m_frame_count;
+
+			WriteCompressedKeyframes();
+		}
+	}
+
+	bool GSDumpZst::WantsKeyframe() const
+	{
+		// Only at chunk boundaries, which is where a replay can resume.
+		return (m_frame_count > 0 && (m_frame_count % GSDUMP_ZST_KEYFRAME_INTERVAL) == 0 &&
+				m_chunk.uncompressed_size == 0 && m_in_buff.empty() && m_last_keyframe_frame != m_frame_count);
+	}
+
+	void GSDumpZst::AddKeyframe(const freezeData& fd, const GSPrivRegSet* regs)
+	{
+		const u32 state_size = static_cast<u32>(fd.size);
+
+		PendingKeyframe kf;
+		kf.uncompressed_size = static_cast<u32>(sizeof(state_size) + state_size + sizeof(*regs));
+		kf.frame = m_frame_count;
+		kf.chunk = static_cast<u32>(m_chunks.size());
+		kf.ok = false;
+		kf.data.resize(kf.uncompressed_size);
+		std::memcpy(kf.data.data(), &state_size, sizeof(state_size));
+		std::memcpy(kf.data.data() + sizeof(state_size), fd.data, state_size);
+		std::memcpy(kf.data.data() + sizeof(state_size) + state_size, regs, sizeof(*regs));
+		m_last_keyframe_frame = m_frame_count;
+
+		if (!m_thread.joinable())
+			m_thread = std::thread(&GSDumpZst::WorkerThread, this);
+
+		{
+			std::unique_lock lock(m_mutex);
+			m_keyframe_queue.push_back(std::move(kf));
+		}
+		m_cv.notify_one();
+	}
+
+	void GSDumpZst::WorkerThread()
+	{
+		Threading::SetNameOfCurrentThread("GS Dump Encoder");
+
+		std::unique_lock lock(m_mutex);
+		for (;;)
+		{
+			m_cv.wait(lock, [this]() { return m_shutdown || !m_keyframe_queue.empty(); });
+			if (m_keyframe_queue.empty())
+				break;
+
+			PendingKeyframe kf = std::move(m_keyframe_queue.front());
+			m_keyframe_queue.pop_front();
+			lock.unlock();
+
+			std::vector<u8> compressed(ZSTD_compressBound(kf.uncompressed_size));
+			const size_t compressed_size = ZSTD_compress(compressed.data(), compressed.size(),
+				kf.data.data(), kf.data.size(), 3);
+			kf.ok = !ZSTD_isError(compressed_size);
+			if (kf.ok)
+			{
+				compressed.resize(compressed_size);
+				kf.data = std::move(compressed);
+			}
+			else
+			{
+				Console.ErrorFmt("GSDumpZstd: Failed to compress keyframe: {}", ZSTD_getErrorName(compressed_size));
+			}
+
+			lock.lock();
+			m_keyframe_done.push_back(std::move(kf));
+		}
+	}
+
+	void GSDumpZst::StopWorkerThread()
+	{
+		if (!m_thread.joinable())
+			return;
+
+		// The worker drains the queue before exiting.
+		{
+			std::unique_lock lock(m_mutex);
+			m_shutdown = true;
+		}
+		m_cv.notify_all();
+		m_thread.join();
+	}
+
+	void GSDumpZst::WriteCompressedKeyframes()
+	{
+		std::deque<PendingKeyframe> done;
+		{
+			std::unique_lock lock(m_mutex);
+			done.swap(m_keyframe_done);
+		}
+
+		for (const PendingKeyframe& pkf : done)
+		{
+			if (!pkf.ok)
+				continue;
+
+			GSDumpZstKeyframe kf = {};
+			kf.file_offset = m_file_offset + sizeof(u32) * 2;
+			kf.compressed_size = static_cast<u32>(pkf.data.size());
+			kf.uncompressed_size = pkf.uncompressed_size;
+			kf.frame = pkf.frame;
+			kf.chunk = pkf.chunk;
+			m_keyframes.push_back(kf);
+
+			WriteSkippableFrame(0, pkf.data.data(), pkf.data.size());
+		}
+
+		// The chunk which was just started begins after them.
+		if (m_chunk.uncompressed_size == 0)
+			m_chunk.file_offset = m_file_offset;
+	}
+
+	void GSDumpZst::WriteSkippableFrame(u32 index, const void* data, size_t size)
+	{
+		const u32 header[2] = {ZSTD_MAGIC_SKIPPABLE_START | index, static_cast<u32>(size)};
+		Write(header, sizeof(header));
+		Write(data, size);
+		m_file_offset += sizeof(header) + size;
+	}
+
+	void GSDumpZst::WriteIndex()
+	{
+		GSDumpZstIndexHeader header = {};
+		header.version = GSDUMP_ZST_INDEX_VERSION;
+		header.frame_count = m_frame_count;
+		header.num_chunks = static_cast<u32>(m_chunks.size());
+		header.num_keyframes = static_cast<u32>(m_keyframes.size());
+
+		const u32 index_size = static_cast<u32>(sizeof(header) + m_chunks.size() * sizeof(GSDumpZstChunk) +
+												m_keyframes.size() * sizeof(GSDumpZstKeyframe));
+
+		std::vector<u8> data(index_size + sizeof(u32) * 2);
+		u8* ptr = data.data();
+		std::memcpy(ptr, &header, sizeof(header));
+		ptr += sizeof(header);
+		std::memcpy(ptr, m_chunks.data(), m_chunks.size() * sizeof(GSDumpZstChunk));
+		ptr += m_chunks.size() * sizeof(GSDumpZstChunk);
+		std::memcpy(ptr, m_keyframes.data(), m_keyframes.size() * sizeof(GSDumpZstKeyframe));
+		ptr += m_keyframes.size() * sizeof(GSDumpZstKeyframe);
+		std::memcpy(ptr, &index_size, sizeof(index_size));
+		ptr += sizeof(index_size);
+		std::memcpy(ptr, &GSDUMP_ZST_INDEX_MAGIC, sizeof(GSDUMP_ZST_INDEX_MAGIC));
+
+		WriteSkippableFrame(1, data.data(), data.size());
 	}
 } // namespace
 
@@ -24,8 +24,26 @@ ReadFIFO2 data (id == 2)
 Regs data (id == 3)
 - [PMODE/0x2000]
 
+Indexed zstd dumps (.gs.zst):
+- The header, up to and including the initial PMODE, is a zstd frame of its own. Every
+  GSDUMP_ZST_CHUNK_FRAMES vsyncs the current frame is ended after the VSync packet, so every
+  following zstd frame decodes to a whole number of packets.
+- Every GSDUMP_ZST_KEYFRAME_INTERVAL vsyncs the frozen GS state and PMODE are zstd compressed into a
+  skippable frame: [state size/4] [state data/size] [PMODE/0x2000]. The compression happens off the GS
+  thread, so the frame lands between two later chunks; the index records where it is and which chunk it applies to.
+- The file ends with a skippable frame holding the index: [GSDumpZstIndexHeader] [GSDumpZstChunk/num_chunks]
+  [GSDumpZstKeyframe/num_keyframes] [index size/4] [GSDUMP_ZST_INDEX_MAGIC/4]
+
+Decoders which don't know about the index skip these frames, and see a regular dump.
+
 */
 
+static constexpr u32 GSDUMP_ZST_INDEX_MAGIC = 0x495A5347; // 'GSZI'
+static constexpr u32 GSDUMP_ZST_INDEX_VERSION = 1;
+static constexpr u32 GSDUMP_ZST_CHUNK_FRAMES = 30;
+static constexpr u32 GSDUMP_ZST_KEYFRAME_INTERVAL = 300;
+static_assert((GSDUMP_ZST_KEYFRAME_INTERVAL % GSDUMP_ZST_CHUNK_FRAMES) == 0, "Keyframes must start a chunk");
+
 #pragma pack(push, 4)
 struct GSDumpHeader
 {
@@ -39,6 +57,31 @@ struct GSDumpHeader
 	u32 screenshot_offset;
 	u32 screenshot_size;
 };
+
+struct GSDumpZstIndexHeader
+{
+	u32 version;
+	u32 frame_count;
+	u32 num_chunks; ///< Including the header chunk, which is always first.
+	u32 num_keyframes;
+};
+
+struct GSDumpZstChunk
+{
+	u64 file_offset;
+	u32 compressed_size;
+	u32 uncompressed_size;
+	u32 first_frame;
+};
+
+struct GSDumpZstKeyframe
+{
+	u64 file_offset; ///< Of the compressed data, after the skippable frame header.
+	u32 compressed_size;
+	u32 uncompressed_size;
+	u32 frame;
+	u32 chunk; ///< First chunk to replay after loading the keyframe.
+};
 #pragma pack(pop)
 
 class GSDumpBase
@@ -57,6 +100,9 @@ protected:
 	virtual void AppendRawData(const void* data, size_t size) = 0;
 	virtual void AppendRawData(u8 c) = 0;
 
+	/// Called after a VSync packet has been appended.
+	virtual void EndFrame() {}
+
 public:
 	GSDumpBase(std::string fn);
 	virtual ~GSDumpBase();
@@ -67,6 +113,10 @@ public:
 	void Transfer(int index, const u8* mem, size_t size);
 	bool VSync(int field, bool last, const GSPrivRegSet* regs);
 
+	/// Returns true if the dump wants the current GS state stored via AddKeyframe(), after VSync().
+	virtual bool WantsKeyframe() const { return false; }
+	virtual void AddKeyframe(const freezeData& fd, const GSPrivRegSet* regs) {}
+
 	static std::unique_ptr<GSDumpBase> CreateUncompressedDump(
 		const std::string& fn, const std::string& serial, u32 crc,
 		u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
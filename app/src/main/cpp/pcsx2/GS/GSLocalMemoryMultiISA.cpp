@@ -6,6 +6,8 @@
 #include "GSBlock.h"
 #include "GSExtra.h"
 
+#include "common/Timer.h"
+
 class CURRENT_ISA::GSLocalMemoryFunctions
 {
 	template <int psm, int bsx, int bsy, int alignment>
@@ -86,6 +88,37 @@ void CURRENT_ISA::GSLocalMemoryPopulateFunctions(GSLocalMemory& mem)
 	GSLocalMemoryFunctions::PopulateFunctions(mem);
 }
 
+u64 CURRENT_ISA::GSBenchmarkSwizzle(u32 iterations)
+{
+	// 32 blocks of 256 bytes, written from and read back to a linear image with the pitch of a single block,
+	// so every call is a dependent chain the compiler can't drop.
+	static constexpr u32 block_count = 32;
+	alignas(64) u8 linear[block_count * 256];
+	alignas(64) u8 swizzled[block_count * 256];
+	for (u32 i = 0; i < sizeof(linear); i++)
+		linear[i] = static_cast<u8>(i * 0x9d);
+
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
+	for (u32 i = 0; i < iterations; i++)
+	{
+		for (u32 block = 0; block < block_count; block++)
+		{
+			u8* src = &linear[block * 256];
+			u8* dst = &swizzled[block * 256];
+			GSBlock::WriteBlock32<16, 0xffffffff>(dst, src, 32);
+			GSBlock::ReadBlock32(dst, src, 32);
+			GSBlock::WriteBlock16<16>(dst, src, 32);
+			GSBlock::ReadBlock16(dst, src, 32);
+			GSBlock::WriteBlock8<16>(dst, src, 16);
+			GSBlock::ReadBlock8(dst, src, 16);
+			GSBlock::WriteBlock4<16>(dst, src, 16);
+			GSBlock::ReadBlock4(dst, src, 16);
+		}
+	}
+
+	return Common::Timer::GetCurrentValue() - start;
+}
+
 void GSLocalMemoryFunctions::PopulateFunctions(GSLocalMemory& mem)
 {
 	mem.m_readImageX = ReadImageX;
@@ -5,6 +5,7 @@
 #include "common/Console.h"
 #include "common/ScopedGuard.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 #include "common/BitUtils.h"
 #include "common/Error.h"
 #include "common/HeapArray.h"
@@ -19,7 +20,9 @@
 #include <XzCrc64.h>
 #include <zstd.h>
 
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 
 using namespace GSDumpTypes;
 
@@ -68,7 +71,65 @@ bool GSDumpFile::GetPreviewImageFromDump(const char* filename, u32* width, u32*
 	return true;
 }
 
+bool GSDumpFile::IsStreaming() const
+{
+	return false;
+}
+
+u32 GSDumpFile::GetFrameCount() const
+{
+	return 0;
+}
+
+bool GSDumpFile::ReadNextChunk(Error* error)
+{
+	Error::SetString(error, "Dump does not support streaming.");
+	return false;
+}
+
+std::optional<u32> GSDumpFile::SeekToFrame(u32 frame, Error* error)
+{
+	Error::SetString(error, "Dump does not have a frame index.");
+	return std::nullopt;
+}
+
 bool GSDumpFile::ReadFile(Error* error)
+{
+	if (!ReadHeader(error))
+		return false;
+
+	// streamed dumps only hold one chunk of packets at a time
+	if (IsStreaming())
+		return ReadNextChunk(error);
+
+	// read all the packet data in
+	// TODO: make this suck less by getting the full/extracted size and preallocating
+	std::vector<u8> packet_data;
+	for (;;)
+	{
+		const size_t packet_data_size = packet_data.size();
+		packet_data.resize(std::max<size_t>(packet_data_size * 2, 8 * _1mb));
+
+		const size_t read_size = packet_data.size() - packet_data_size;
+		const size_t read = Read(packet_data.data() + packet_data_size, read_size);
+		if (read != read_size)
+		{
+			if (!IsEof())
+			{
+				Error::SetString(error, "Failed to read packet");
+				return false;
+			}
+
+			packet_data.resize(packet_data_size + read);
+			packet_data.shrink_to_fit();
+			break;
+		}
+	}
+
+	return ParsePackets(std::move(packet_data), error);
+}
+
+bool GSDumpFile::ReadHeader(Error* error)
 {
 	u32 ss;
 	if (Read(&m_crc, sizeof(m_crc)) != sizeof(m_crc) || Read(&ss, sizeof(ss)) != sizeof(ss))
@@ -126,28 +187,13 @@ bool GSDumpFile::ReadFile(Error* error)
 		return false;
 	}
 
-	// read all the packet data in
-	// TODO: make this suck less by getting the full/extracted size and preallocating
-	for (;;)
-	{
-		const size_t packet_data_size = m_packet_data.size();
-		m_packet_data.resize(std::max<size_t>(packet_data_size * 2, 8 * _1mb));
-
-		const size_t read_size = m_packet_data.size() - packet_data_size;
-		const size_t read = Read(m_packet_data.data() + packet_data_size, read_size);
-		if (read != read_size)
-		{
-			if (!IsEof())
-			{
-				Error::SetString(error, "Failed to read packet");
-				return false;
-			}
+	return true;
+}
 
-			m_packet_data.resize(packet_data_size + read);
-			m_packet_data.shrink_to_fit();
-			break;
-		}
-	}
+bool GSDumpFile::ParsePackets(std::vector<u8> packet_data, Error* error)
+{
+	m_packet_data = std::move(packet_data);
+	m_dump_packets.clear();
 
 	u8* data = m_packet_data.data();
 	size_t remaining = m_packet_data.size();
@@ -534,6 +580,10 @@ namespace
 				}
 			}
 
+			// Trailing skippable frames (e.g. the index) decode to nothing.
+			if (m_inbuf.pos == m_inbuf.size && std::feof(m_fp.get()))
+				break;
+
 			const size_t ret = ZSTD_decompressStream(m_strm, &outbuf, &m_inbuf);
 			if (ZSTD_isError(ret))
 			{
@@ -577,6 +627,325 @@ namespace
 
 	/******************************************************************/
 
+	/// Reader for zstd dumps with a frame index (see GSDump.h). Only one chunk of packets is held at a time,
+	/// and the chunk after it is decompressed on a worker thread while the current one is replayed.
+	class GSDumpIndexedZst final : public GSDumpFile
+	{
+	public:
+		GSDumpIndexedZst();
+		~GSDumpIndexedZst() override;
+
+		static bool HasIndex(std::FILE* fp);
+
+		bool IsStreaming() const override;
+		u32 GetFrameCount() const override;
+		bool ReadNextChunk(Error* error) override;
+		std::optional<u32> SeekToFrame(u32 frame, Error* error) override;
+
+	protected:
+		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
+		bool IsEof() override;
+		size_t Read(void* ptr, size_t size) override;
+
+	private:
+		static constexpr u32 NO_CHUNK = 0xFFFFFFFFu;
+
+		static bool ReadIndex(std::FILE* fp, GSDumpZstIndexHeader* header, std::vector<u8>* data);
+
+		bool Decompress(ZSTD_DCtx* dctx, u64 offset, u32 compressed_size, u32 uncompressed_size, std::vector<u8>* out);
+		void RequestChunk(u32 chunk);
+		void WorkerThread();
+
+		std::vector<GSDumpZstChunk> m_chunks;
+		std::vector<GSDumpZstKeyframe> m_keyframes;
+		u32 m_frame_count = 0;
+		u32 m_next_chunk = 1;
+
+		ZSTD_DCtx* m_dctx = nullptr;
+		std::mutex m_file_mutex;
+
+		// Header chunk, which Read() returns.
+		std::vector<u8> m_header_data;
+		size_t m_header_pos = 0;
+
+		std::thread m_thread;
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		u32 m_requested_chunk = NO_CHUNK;
+		u32 m_ready_chunk = NO_CHUNK;
+		bool m_ready_ok = false;
+		bool m_shutdown = false;
+		std::vector<u8> m_ready_data;
+	};
+
+	GSDumpIndexedZst::GSDumpIndexedZst() = default;
+
+	GSDumpIndexedZst::~GSDumpIndexedZst()
+	{
+		if (m_thread.joinable())
+		{
+			{
+				std::unique_lock lock(m_mutex);
+				m_shutdown = true;
+			}
+			m_cv.notify_all();
+			m_thread.join();
+		}
+
+		if (m_dctx)
+			ZSTD_freeDCtx(m_dctx);
+	}
+
+	bool GSDumpIndexedZst::ReadIndex(std::FILE* fp, GSDumpZstIndexHeader* header, std::vector<u8>* data)
+	{
+		const s64 file_size = FileSystem::FSize64(fp);
+		u32 footer[2];
+		if (file_size < static_cast<s64>(sizeof(footer) + sizeof(GSDumpZstIndexHeader)) ||
+			FileSystem::FSeek64(fp, file_size - static_cast<s64>(sizeof(footer)), SEEK_SET) != 0 ||
+			std::fread(footer, sizeof(footer), 1, fp) != 1 || footer[1] != GSDUMP_ZST_INDEX_MAGIC ||
+			footer[0] < sizeof(GSDumpZstIndexHeader) || footer[0] > (static_cast<u64>(file_size) - sizeof(footer)))
+		{
+			return false;
+		}
+
+		data->resize(footer[0]);
+		if (FileSystem::FSeek64(fp, file_size - static_cast<s64>(sizeof(footer)) - footer[0], SEEK_SET) != 0 ||
+			std::fread(data->data(), data->size(), 1, fp) != 1)
+		{
+			return false;
+		}
+
+		std::memcpy(header, data->data(), sizeof(*header));
+		return (header->version == GSDUMP_ZST_INDEX_VERSION && header->num_chunks > 0 &&
+				data->size() == (sizeof(*header) + header->num_chunks * sizeof(GSDumpZstChunk) +
+									header->num_keyframes * sizeof(GSDumpZstKeyframe)));
+	}
+
+	bool GSDumpIndexedZst::HasIndex(std::FILE* fp)
+	{
+		GSDumpZstIndexHeader header;
+		std::vector<u8> data;
+		const bool ret = ReadIndex(fp, &header, &data);
+		FileSystem::FSeek64(fp, 0, SEEK_SET);
+		return ret;
+	}
+
+	bool GSDumpIndexedZst::Open(FileSystem::ManagedCFilePtr fp, Error* error)
+	{
+		m_fp = std::move(fp);
+
+		GSDumpZstIndexHeader header;
+		std::vector<u8> data;
+		if (!ReadIndex(m_fp.get(), &header, &data))
+		{
+			Error::SetString(error, "Failed to read dump index.");
+			return false;
+		}
+
+		const u8* ptr = data.data() + sizeof(header);
+		m_chunks.resize(header.num_chunks);
+		std::memcpy(m_chunks.data(), ptr, header.num_chunks * sizeof(GSDumpZstChunk));
+		ptr += header.num_chunks * sizeof(GSDumpZstChunk);
+		m_keyframes.resize(header.num_keyframes);
+		std::memcpy(m_keyframes.data(), ptr, header.num_keyframes * sizeof(GSDumpZstKeyframe));
+		m_frame_count = header.frame_count;
+
+		m_dctx = ZSTD_createDCtx();
+		const GSDumpZstChunk& hc = m_chunks.front();
+		if (!m_dctx || !Decompress(m_dctx, hc.file_offset, hc.compressed_size, hc.uncompressed_size, &m_header_data))
+		{
+			Error::SetString(error, "Failed to decompress dump header.");
+			return false;
+		}
+
+		DevCon.WriteLnFmt("(GSDump) Indexed zstd dump with {} frames, {} chunks and {} keyframes",
+			m_frame_count, m_chunks.size() - 1, m_keyframes.size());
+
+		m_thread = std::thread(&GSDumpIndexedZst::WorkerThread, this);
+		return true;
+	}
+
+	bool GSDumpIndexedZst::IsEof()
+	{
+		return (m_header_pos == m_header_data.size());
+	}
+
+	size_t GSDumpIndexedZst::Read(void* ptr, size_t size)
+	{
+		const size_t read = std::min(size, m_header_data.size() - m_header_pos);
+		std::memcpy(ptr, m_header_data.data() + m_header_pos, read);
+		m_header_pos += read;
+		return read;
+	}
+
+	bool GSDumpIndexedZst::IsStreaming() const
+	{
+		return true;
+	}
+
+	u32 GSDumpIndexedZst::GetFrameCount() const
+	{
+		return m_frame_count;
+	}
+
+	bool GSDumpIndexedZst::Decompress(ZSTD_DCtx* dctx, u64 offset, u32 compressed_size, u32 uncompressed_size, std::vector<u8>* out)
+	{
+		std::vector<u8> compressed(compressed_size);
+		{
+			std::unique_lock lock(m_file_mutex);
+			if (FileSystem::FSeek64(m_fp.get(), static_cast<s64>(offset), SEEK_SET) != 0 ||
+				std::fread(compressed.data(), compressed_size, 1, m_fp.get()) != 1)
+			{
+				Console.ErrorFmt("(GSDump) Failed to read {} bytes from offset {}", compressed_size, offset);
+				return false;
+			}
+		}
+
+		out->resize(uncompressed_size);
+		const size_t ret = ZSTD_decompressDCtx(dctx, out->data(), out->size(), compressed.data(), compressed.size());
+		if (ZSTD_isError(ret) || ret != uncompressed_size)
+		{
+			Console.ErrorFmt("(GSDump) Failed to decompress chunk at offset {}: {}", offset,
+				ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "size mismatch");
+			return false;
+		}
+
+		return true;
+	}
+
+	void GSDumpIndexedZst::RequestChunk(u32 chunk)
+	{
+		{
+			std::unique_lock lock(m_mutex);
+			if (m_requested_chunk == chunk || m_ready_chunk == chunk)
+				return;
+
+			m_requested_chunk = chunk;
+		}
+
+		m_cv.notify_all();
+	}
+
+	void GSDumpIndexedZst::WorkerThread()
+	{
+		Threading::SetNameOfCurrentThread("GS Dump Decoder");
+
+		ZSTD_DCtx* dctx = ZSTD_createDCtx();
+		std::vector<u8> data;
+
+		std::unique_lock lock(m_mutex);
+		for (;;)
+		{
+			m_cv.wait(lock, [this]() { return m_shutdown || m_requested_chunk != NO_CHUNK; });
+			if (m_shutdown)
+				break;
+
+			const u32 chunk = m_requested_chunk;
+			const GSDumpZstChunk& c = m_chunks[chunk];
+			lock.unlock();
+
+			const bool ok = dctx && Decompress(dctx, c.file_offset, c.compressed_size, c.uncompressed_size, &data);
+
+			lock.lock();
+
+			// drop the result if a seek asked for something else in the meantime
+			if (m_requested_chunk != chunk)
+				continue;
+
+			m_requested_chunk = NO_CHUNK;
+			m_ready_chunk = chunk;
+			m_ready_ok = ok;
+			m_ready_data.swap(data);
+			m_cv.notify_all();
+		}
+
+		if (dctx)
+			ZSTD_freeDCtx(dctx);
+	}
+
+	bool GSDumpIndexedZst::ReadNextChunk(Error* error)
+	{
+		if (m_next_chunk >= m_chunks.size())
+			return false;
+
+		const u32 chunk = m_next_chunk;
+		RequestChunk(chunk);
+
+		std::vector<u8> data;
+		bool ok;
+		{
+			std::unique_lock lock(m_mutex);
+			m_cv.wait(lock, [this, chunk]() { return m_ready_chunk == chunk; });
+			m_ready_chunk = NO_CHUNK;
+			ok = m_ready_ok;
+			data.swap(m_ready_data);
+		}
+
+		if (!ok)
+		{
+			Error::SetString(error, fmt::format("Failed to decompress chunk {}", chunk));
+			return false;
+		}
+
+		m_next_chunk++;
+
+		// decode ahead while this one is replayed
+		if (m_next_chunk < m_chunks.size())
+			RequestChunk(m_next_chunk);
+
+		return ParsePackets(std::move(data), error);
+	}
+
+	std::optional<u32> GSDumpIndexedZst::SeekToFrame(u32 frame, Error* error)
+	{
+		const GSDumpZstKeyframe* kf = nullptr;
+		for (const GSDumpZstKeyframe& it : m_keyframes)
+		{
+			if (it.frame > frame)
+				break;
+			kf = &it;
+		}
+
+		if (!kf)
+		{
+			// before the first keyframe, start over with the header state
+			m_header_pos = 0;
+			if (!ReadHeader(error))
+				return std::nullopt;
+
+			m_next_chunk = 1;
+			RequestChunk(m_next_chunk);
+			return 0;
+		}
+
+		std::vector<u8> data;
+		u32 state_size = 0;
+		bool ok = Decompress(m_dctx, kf->file_offset, kf->compressed_size, kf->uncompressed_size, &data) &&
+				  data.size() >= sizeof(state_size);
+		if (ok)
+		{
+			std::memcpy(&state_size, data.data(), sizeof(state_size));
+			ok = (data.size() >= (sizeof(state_size) + state_size + 8192));
+		}
+		if (!ok)
+		{
+			Error::SetString(error, fmt::format("Failed to load keyframe for frame {}", kf->frame));
+			return std::nullopt;
+		}
+
+		const u8* state = data.data() + sizeof(state_size);
+		m_state_data.assign(state, state + state_size);
+		m_regs_data.assign(state + state_size, data.data() + data.size());
+
+		m_next_chunk = kf->chunk;
+		if (m_next_chunk < m_chunks.size())
+			RequestChunk(m_next_chunk);
+
+		return kf->frame;
+	}
+
+	/******************************************************************/
+
 	class GSDumpRaw final : public GSDumpFile
 	{
 	public:
@@ -627,7 +996,12 @@ std::unique_ptr<GSDumpFile> GSDumpFile::OpenGSDump(const char* filename, Error*
 	if (StringUtil::EndsWithNoCase(filename, ".xz"))
 		file = std::make_unique<GSDumpLzma>();
 	else if (StringUtil::EndsWithNoCase(filename, ".zst"))
-		file = std::make_unique<GSDumpDecompressZst>();
+	{
+		if (GSDumpIndexedZst::HasIndex(fp.get()))
+			file = std::make_unique<GSDumpIndexedZst>();
+		else
+			file = std::make_unique<GSDumpDecompressZst>();
+	}
 	else
 		file = std::make_unique<GSDumpRaw>();
 
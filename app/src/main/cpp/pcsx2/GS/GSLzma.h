@@ -6,6 +6,7 @@
 #include "common/FileSystem.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -304,6 +305,20 @@ public:
 
 	bool ReadFile(Error* error);
 
+	/// Returns true if packets are decoded a chunk at a time by ReadNextChunk(), instead of all at once.
+	virtual bool IsStreaming() const;
+
+	/// Returns the number of frames in the dump, or zero if it has no frame index.
+	virtual u32 GetFrameCount() const;
+
+	/// Replaces the packets with the next chunk of the dump. Returns false at the end of the dump.
+	virtual bool ReadNextChunk(Error* error);
+
+	/// Moves to the closest keyframe at or before the specified frame, and replaces the state and register
+	/// data with it. The packets following the keyframe are returned by the next ReadNextChunk() call.
+	/// Returns the frame number of the keyframe.
+	virtual std::optional<u32> SeekToFrame(u32 frame, Error* error);
+
 protected:
 	GSDumpFile();
 
@@ -311,15 +326,19 @@ protected:
 	virtual bool IsEof() = 0;
 	virtual size_t Read(void* ptr, size_t size) = 0;
 
+	bool ReadHeader(Error* error);
+	bool ParsePackets(std::vector<u8> data, Error* error);
+
 protected:
 	FileSystem::ManagedCFilePtr m_fp;
 
+	std::vector<u8> m_regs_data;
+	std::vector<u8> m_state_data;
+
 private:
 	std::string m_serial;
 	u32 m_crc = 0;
 
-	std::vector<u8> m_regs_data;
-	std::vector<u8> m_state_data;
 	std::vector<u8> m_packet_data;
 
 	GSDataArray m_dump_packets;
@@ -20,6 +20,7 @@ public:
 		Unswizzle,
 		Fillrate,
 		SyncPoint,
+		SyncAvoided,
 		Barriers,
 		RenderPasses,
 		CounterLast,
@@ -27,6 +28,7 @@ public:
 		// Reused counters for HW.
 		TextureCopies = Fillrate,
 		TextureUploads = SyncPoint,
+		MergedUploads = SyncAvoided,
 	};
 
 protected:
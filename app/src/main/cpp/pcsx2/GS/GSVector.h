@@ -104,8 +104,14 @@ class GSVector8i;
 #include "GSVector8.h"
 
 #elif defined(_M_ARM64)
+
+class GSVector8;
+class GSVector8i;
+
 #include "GSVector4i_arm64.h"
 #include "GSVector4_arm64.h"
+#include "GSVector8i_arm64.h"
+#include "GSVector8_arm64.h"
 #endif
 
 // conversion
@@ -162,6 +168,36 @@ __forceinline_odr void GSVector8i::sw32_inv(GSVector8i& a, GSVector8i& b)
 	b = GSVector8i::cast(af.ywyw(bf));
 }
 
+#elif defined(_M_ARM64)
+
+__forceinline_odr GSVector8i::GSVector8i(const GSVector8& v, bool truncate)
+{
+	if (truncate)
+	{
+		v4s[0] = vcvtq_s32_f32(v.v4s[0]);
+		v4s[1] = vcvtq_s32_f32(v.v4s[1]);
+	}
+	else
+	{
+		v4s[0] = vcvtnq_s32_f32(v.v4s[0]);
+		v4s[1] = vcvtnq_s32_f32(v.v4s[1]);
+	}
+}
+
+__forceinline_odr GSVector8::GSVector8(const GSVector8i& v)
+{
+	v4s[0] = vcvtq_f32_s32(v.v4s[0]);
+	v4s[1] = vcvtq_f32_s32(v.v4s[1]);
+}
+
+__forceinline_odr void GSVector8i::sw32_inv(GSVector8i& a, GSVector8i& b)
+{
+	GSVector8 af = GSVector8::cast(a);
+	GSVector8 bf = GSVector8::cast(b);
+	a = GSVector8i::cast(af.xzxz(bf));
+	b = GSVector8i::cast(af.ywyw(bf));
+}
+
 #endif
 
 // casting
@@ -242,3 +278,26 @@ __forceinline_odr GSVector8 GSVector8::cast(const GSVector8i& v)
 
 #endif
 
+#if defined(_M_ARM64)
+
+__forceinline_odr GSVector8i GSVector8i::cast(const GSVector4i& v)
+{
+	return GSVector8i(v.v4s, vdupq_n_s32(0));
+}
+
+__forceinline_odr GSVector8i GSVector8i::cast(const GSVector4& v)
+{
+	return GSVector8i(vreinterpretq_s32_f32(v.v4s), vdupq_n_s32(0));
+}
+
+__forceinline_odr GSVector8i GSVector8i::cast(const GSVector8& v)
+{
+	return GSVector8i(vreinterpretq_s32_f32(v.v4s[0]), vreinterpretq_s32_f32(v.v4s[1]));
+}
+
+__forceinline_odr GSVector8 GSVector8::cast(const GSVector8i& v)
+{
+	return GSVector8(vreinterpretq_f32_s32(v.v4s[0]), vreinterpretq_f32_s32(v.v4s[1]));
+}
+
+#endif
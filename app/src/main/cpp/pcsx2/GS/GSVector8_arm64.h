@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+/// 256-bit float vector built from a pair of 128-bit NEON registers, see GSVector8i_arm64.h.
+/// Shuffles are per-128-bit-lane, matching vshufps.
+class alignas(32) GSVector8
+{
+	struct cxpr_init_tag
+	{
+	};
+	static constexpr cxpr_init_tag cxpr_init{};
+
+	constexpr GSVector8(cxpr_init_tag, float x0, float y0, float z0, float w0, float x1, float y1, float z1, float w1)
+		: F32{x0, y0, z0, w0, x1, y1, z1, w1}
+	{
+	}
+
+	constexpr GSVector8(cxpr_init_tag, int x0, int y0, int z0, int w0, int x1, int y1, int z1, int w1)
+		: I32{x0, y0, z0, w0, x1, y1, z1, w1}
+	{
+	}
+
+public:
+	union
+	{
+		struct { float x0, y0, z0, w0, x1, y1, z1, w1; };
+		struct { float r0, g0, b0, a0, r1, g1, b1, a1; };
+		float v[8];
+		float F32[8];
+		s8 I8[32];
+		s16 I16[16];
+		s32 I32[8];
+		s64 I64[4];
+		u8 U8[32];
+		u16 U16[16];
+		u32 U32[8];
+		u64 U64[4];
+		float32x4_t v4s[2];
+	};
+
+	GSVector8() = default;
+
+	static constexpr GSVector8 cxpr(float x0, float y0, float z0, float w0, float x1, float y1, float z1, float w1)
+	{
+		return GSVector8(cxpr_init, x0, y0, z0, w0, x1, y1, z1, w1);
+	}
+
+	static constexpr GSVector8 cxpr(float x)
+	{
+		return GSVector8(cxpr_init, x, x, x, x, x, x, x, x);
+	}
+
+	static constexpr GSVector8 cxpr(int x)
+	{
+		return GSVector8(cxpr_init, x, x, x, x, x, x, x, x);
+	}
+
+	__forceinline GSVector8(float x0, float y0, float z0, float w0, float x1, float y1, float z1, float w1)
+		: F32{x0, y0, z0, w0, x1, y1, z1, w1}
+	{
+	}
+
+	__forceinline constexpr GSVector8(float32x4_t lo, float32x4_t hi)
+		: v4s{lo, hi}
+	{
+	}
+
+	__forceinline GSVector8(const GSVector4& lo, const GSVector4& hi)
+		: v4s{lo.v4s, hi.v4s}
+	{
+	}
+
+	__forceinline explicit GSVector8(float f)
+	{
+		*this = f;
+	}
+
+	__forceinline explicit GSVector8(const GSVector8i& v);
+
+	__forceinline static GSVector8 cast(const GSVector8i& v);
+
+	__forceinline void operator=(float f)
+	{
+		v4s[0] = vdupq_n_f32(f);
+		v4s[1] = v4s[0];
+	}
+
+	__forceinline GSVector8 abs() const
+	{
+		return GSVector8(vabsq_f32(v4s[0]), vabsq_f32(v4s[1]));
+	}
+
+	__forceinline GSVector8 neg() const
+	{
+		return GSVector8(vnegq_f32(v4s[0]), vnegq_f32(v4s[1]));
+	}
+
+	__forceinline GSVector8 floor() const
+	{
+		return GSVector8(vrndmq_f32(v4s[0]), vrndmq_f32(v4s[1]));
+	}
+
+	__forceinline GSVector8 ceil() const
+	{
+		return GSVector8(vrndpq_f32(v4s[0]), vrndpq_f32(v4s[1]));
+	}
+
+	__forceinline GSVector8 madd(const GSVector8& a, const GSVector8& b) const
+	{
+		return GSVector8(vfmaq_f32(b.v4s[0], v4s[0], a.v4s[0]), vfmaq_f32(b.v4s[1], v4s[1], a.v4s[1]));
+	}
+
+	__forceinline GSVector8 min(const GSVector8& a) const
+	{
+		return GSVector8(vminq_f32(v4s[0], a.v4s[0]), vminq_f32(v4s[1], a.v4s[1]));
+	}
+
+	__forceinline GSVector8 max(const GSVector8& a) const
+	{
+		return GSVector8(vmaxq_f32(v4s[0], a.v4s[0]), vmaxq_f32(v4s[1], a.v4s[1]));
+	}
+
+	__forceinline GSVector8 blend32(const GSVector8& a, const GSVector8& mask) const
+	{
+		// duplicate sign bit across and bit select
+		const uint32x4_t bitmask0 = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(mask.v4s[0]), 31));
+		const uint32x4_t bitmask1 = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(mask.v4s[1]), 31));
+		return GSVector8(vbslq_f32(bitmask0, a.v4s[0], v4s[0]), vbslq_f32(bitmask1, a.v4s[1], v4s[1]));
+	}
+
+	__forceinline int mask() const
+	{
+		const uint32x4_t lo = vshrq_n_u32(vreinterpretq_u32_f32(v4s[0]), 31);
+		const uint32x4_t hi = vshrq_n_u32(vreinterpretq_u32_f32(v4s[1]), 31);
+		static constexpr const int32_t shifts[] = {0, 1, 2, 3};
+		const int32x4_t shift = vld1q_s32(shifts);
+		return static_cast<int>(vaddvq_u32(vshlq_u32(lo, shift)) | (vaddvq_u32(vshlq_u32(hi, shift)) << 4));
+	}
+
+	__forceinline static GSVector8 zero()
+	{
+		return GSVector8(vdupq_n_f32(0.0f), vdupq_n_f32(0.0f));
+	}
+
+	template <bool aligned>
+	__forceinline static GSVector8 load(const void* p)
+	{
+		const float32x4x2_t v = vld1q_f32_x2(static_cast<const float*>(p));
+		return GSVector8(v.val[0], v.val[1]);
+	}
+
+	template <bool aligned>
+	__forceinline static void store(void* p, const GSVector8& v)
+	{
+		vst1q_f32_x2(static_cast<float*>(p), float32x4x2_t{{v.v4s[0], v.v4s[1]}});
+	}
+
+	__forceinline void operator+=(const GSVector8& v) { *this = *this + v; }
+	__forceinline void operator-=(const GSVector8& v) { *this = *this - v; }
+	__forceinline void operator*=(const GSVector8& v) { *this = *this * v; }
+	__forceinline void operator/=(const GSVector8& v) { *this = *this / v; }
+
+	__forceinline friend GSVector8 operator+(const GSVector8& v1, const GSVector8& v2) { return GSVector8(vaddq_f32(v1.v4s[0], v2.v4s[0]), vaddq_f32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8 operator-(const GSVector8& v1, const GSVector8& v2) { return GSVector8(vsubq_f32(v1.v4s[0], v2.v4s[0]), vsubq_f32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8 operator*(const GSVector8& v1, const GSVector8& v2) { return GSVector8(vmulq_f32(v1.v4s[0], v2.v4s[0]), vmulq_f32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8 operator/(const GSVector8& v1, const GSVector8& v2) { return GSVector8(vdivq_f32(v1.v4s[0], v2.v4s[0]), vdivq_f32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8 operator+(const GSVector8& v, float f) { return v + GSVector8(f); }
+	__forceinline friend GSVector8 operator-(const GSVector8& v, float f) { return v - GSVector8(f); }
+	__forceinline friend GSVector8 operator*(const GSVector8& v, float f) { return v * GSVector8(f); }
+	__forceinline friend GSVector8 operator/(const GSVector8& v, float f) { return v / GSVector8(f); }
+
+	__forceinline friend GSVector8 operator&(const GSVector8& v1, const GSVector8& v2)
+	{
+		return GSVector8(
+			vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v1.v4s[0]), vreinterpretq_u32_f32(v2.v4s[0]))),
+			vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v1.v4s[1]), vreinterpretq_u32_f32(v2.v4s[1]))));
+	}
+
+	__forceinline friend GSVector8 operator|(const GSVector8& v1, const GSVector8& v2)
+	{
+		return GSVector8(
+			vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(v1.v4s[0]), vreinterpretq_u32_f32(v2.v4s[0]))),
+			vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(v1.v4s[1]), vreinterpretq_u32_f32(v2.v4s[1]))));
+	}
+
+	__forceinline friend GSVector8 operator^(const GSVector8& v1, const GSVector8& v2)
+	{
+		return GSVector8(
+			vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v1.v4s[0]), vreinterpretq_u32_f32(v2.v4s[0]))),
+			vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v1.v4s[1]), vreinterpretq_u32_f32(v2.v4s[1]))));
+	}
+
+	__forceinline friend GSVector8 operator==(const GSVector8& v1, const GSVector8& v2)
+	{
+		return GSVector8(vreinterpretq_f32_u32(vceqq_f32(v1.v4s[0], v2.v4s[0])), vreinterpretq_f32_u32(vceqq_f32(v1.v4s[1], v2.v4s[1])));
+	}
+
+	__forceinline friend GSVector8 operator<(const GSVector8& v1, const GSVector8& v2)
+	{
+		return GSVector8(vreinterpretq_f32_u32(vcltq_f32(v1.v4s[0], v2.v4s[0])), vreinterpretq_f32_u32(vcltq_f32(v1.v4s[1], v2.v4s[1])));
+	}
+
+	__forceinline friend GSVector8 operator>(const GSVector8& v1, const GSVector8& v2)
+	{
+		return GSVector8(vreinterpretq_f32_u32(vcgtq_f32(v1.v4s[0], v2.v4s[0])), vreinterpretq_f32_u32(vcgtq_f32(v1.v4s[1], v2.v4s[1])));
+	}
+
+	// clang-format off
+
+	#define VECTOR8_SHUFFLE_4(xs, xn, ys, yn, zs, zn, ws, wn) \
+		__forceinline GSVector8 xs##ys##zs##ws() const { return GSVector8(__builtin_shufflevector(v4s[0], v4s[0], xn, yn, zn, wn), __builtin_shufflevector(v4s[1], v4s[1], xn, yn, zn, wn)); } \
+		__forceinline GSVector8 xs##ys##zs##ws(const GSVector8& v) const { return GSVector8(__builtin_shufflevector(v4s[0], v.v4s[0], xn, yn, 4 + zn, 4 + wn), __builtin_shufflevector(v4s[1], v.v4s[1], xn, yn, 4 + zn, 4 + wn)); }
+
+	#define VECTOR8_SHUFFLE_3(xs, xn, ys, yn, zs, zn) \
+		VECTOR8_SHUFFLE_4(xs, xn, ys, yn, zs, zn, x, 0) \
+		VECTOR8_SHUFFLE_4(xs, xn, ys, yn, zs, zn, y, 1) \
+		VECTOR8_SHUFFLE_4(xs, xn, ys, yn, zs, zn, z, 2) \
+		VECTOR8_SHUFFLE_4(xs, xn, ys, yn, zs, zn, w, 3) \
+
+	#define VECTOR8_SHUFFLE_2(xs, xn, ys, yn) \
+		VECTOR8_SHUFFLE_3(xs, xn, ys, yn, x, 0) \
+		VECTOR8_SHUFFLE_3(xs, xn, ys, yn, y, 1) \
+		VECTOR8_SHUFFLE_3(xs, xn, ys, yn, z, 2) \
+		VECTOR8_SHUFFLE_3(xs, xn, ys, yn, w, 3) \
+
+	#define VECTOR8_SHUFFLE_1(xs, xn) \
+		VECTOR8_SHUFFLE_2(xs, xn, x, 0) \
+		VECTOR8_SHUFFLE_2(xs, xn, y, 1) \
+		VECTOR8_SHUFFLE_2(xs, xn, z, 2) \
+		VECTOR8_SHUFFLE_2(xs, xn, w, 3) \
+
+	VECTOR8_SHUFFLE_1(x, 0)
+	VECTOR8_SHUFFLE_1(y, 1)
+	VECTOR8_SHUFFLE_1(z, 2)
+	VECTOR8_SHUFFLE_1(w, 3)
+
+	// clang-format on
+};
@@ -0,0 +1,754 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Assertions.h"
+
+/// 256-bit integer vector built from a pair of 128-bit NEON registers.
+/// Semantics follow the AVX2 GSVector8i: anything that is per-128-bit-lane on x86 (shuffle8, unpacks, packs,
+/// byte shifts, hadds) is applied independently to each half, cross-lane permutes (acbd, ba, u8to32, ...) move
+/// data between the halves. This lets the wide kernels in GSBlock/ReverbResample build unchanged on ARM64, where
+/// the doubled unrolling gives wide out-of-order cores more independent work per iteration.
+class alignas(32) GSVector8i
+{
+	struct cxpr_init_tag
+	{
+	};
+	static constexpr cxpr_init_tag cxpr_init{};
+
+	constexpr GSVector8i(cxpr_init_tag, int x0, int y0, int z0, int w0, int x1, int y1, int z1, int w1)
+		: I32{x0, y0, z0, w0, x1, y1, z1, w1}
+	{
+	}
+
+	__forceinline GSVector4i l() const { return GSVector4i(v4s[0]); }
+	__forceinline GSVector4i h() const { return GSVector4i(v4s[1]); }
+
+	template <int i>
+	__forceinline GSVector4i sel128(const GSVector8i& v) const
+	{
+		static_assert(i == 0 || i == 1 || i == 2 || i == 3 || i == 8);
+
+		if constexpr (i == 0)
+			return l();
+		else if constexpr (i == 1)
+			return h();
+		else if constexpr (i == 2)
+			return v.l();
+		else if constexpr (i == 3)
+			return v.h();
+		else
+			return GSVector4i::zero();
+	}
+
+	template <int an, int bn, int cn, int dn>
+	__forceinline GSVector8i permute64() const
+	{
+		const int64x2_t lo = vreinterpretq_s64_s32(v4s[0]);
+		const int64x2_t hi = vreinterpretq_s64_s32(v4s[1]);
+		return GSVector8i(
+			vreinterpretq_s32_s64(__builtin_shufflevector(lo, hi, an, bn)),
+			vreinterpretq_s32_s64(__builtin_shufflevector(lo, hi, cn, dn)));
+	}
+
+public:
+	union
+	{
+		struct { int x0, y0, z0, w0, x1, y1, z1, w1; };
+		struct { int r0, g0, b0, a0, r1, g1, b1, a1; };
+		int v[8];
+		float F32[8];
+		s8 I8[32];
+		s16 I16[16];
+		s32 I32[8];
+		s64 I64[4];
+		u8 U8[32];
+		u16 U16[16];
+		u32 U32[8];
+		u64 U64[4];
+		int32x4_t v4s[2];
+	};
+
+	GSVector8i() = default;
+
+	static constexpr GSVector8i cxpr(int x0, int y0, int z0, int w0, int x1, int y1, int z1, int w1)
+	{
+		return GSVector8i(cxpr_init, x0, y0, z0, w0, x1, y1, z1, w1);
+	}
+
+	static constexpr GSVector8i cxpr(int x)
+	{
+		return GSVector8i(cxpr_init, x, x, x, x, x, x, x, x);
+	}
+
+	__forceinline explicit GSVector8i(const GSVector8& v, bool truncate = true);
+
+	__forceinline static GSVector8i cast(const GSVector8& v);
+	__forceinline static GSVector8i cast(const GSVector4& v);
+	__forceinline static GSVector8i cast(const GSVector4i& v);
+
+	__forceinline GSVector8i(int x0, int y0, int z0, int w0, int x1, int y1, int z1, int w1)
+		: I32{x0, y0, z0, w0, x1, y1, z1, w1}
+	{
+	}
+
+	__forceinline GSVector8i(const GSVector4i& lo, const GSVector4i& hi)
+		: v4s{lo.v4s, hi.v4s}
+	{
+	}
+
+	__forceinline constexpr GSVector8i(int32x4_t lo, int32x4_t hi)
+		: v4s{lo, hi}
+	{
+	}
+
+	__forceinline explicit GSVector8i(int i)
+	{
+		*this = i;
+	}
+
+	/// Broadcasts the 128-bit vector to both halves, like the __m128i constructor on x86.
+	__forceinline explicit GSVector8i(const GSVector4i& v)
+		: v4s{v.v4s, v.v4s}
+	{
+	}
+
+	__forceinline void operator=(int i)
+	{
+		v4s[0] = vdupq_n_s32(i);
+		v4s[1] = v4s[0];
+	}
+
+	//
+
+	__forceinline GSVector8i min_i8(const GSVector8i& a) const { return GSVector8i(l().min_i8(a.l()), h().min_i8(a.h())); }
+	__forceinline GSVector8i max_i8(const GSVector8i& a) const { return GSVector8i(l().max_i8(a.l()), h().max_i8(a.h())); }
+	__forceinline GSVector8i min_i16(const GSVector8i& a) const { return GSVector8i(l().min_i16(a.l()), h().min_i16(a.h())); }
+	__forceinline GSVector8i max_i16(const GSVector8i& a) const { return GSVector8i(l().max_i16(a.l()), h().max_i16(a.h())); }
+	__forceinline GSVector8i min_i32(const GSVector8i& a) const { return GSVector8i(l().min_i32(a.l()), h().min_i32(a.h())); }
+	__forceinline GSVector8i max_i32(const GSVector8i& a) const { return GSVector8i(l().max_i32(a.l()), h().max_i32(a.h())); }
+	__forceinline GSVector8i min_u8(const GSVector8i& a) const { return GSVector8i(l().min_u8(a.l()), h().min_u8(a.h())); }
+	__forceinline GSVector8i max_u8(const GSVector8i& a) const { return GSVector8i(l().max_u8(a.l()), h().max_u8(a.h())); }
+	__forceinline GSVector8i min_u16(const GSVector8i& a) const { return GSVector8i(l().min_u16(a.l()), h().min_u16(a.h())); }
+	__forceinline GSVector8i max_u16(const GSVector8i& a) const { return GSVector8i(l().max_u16(a.l()), h().max_u16(a.h())); }
+	__forceinline GSVector8i min_u32(const GSVector8i& a) const { return GSVector8i(l().min_u32(a.l()), h().min_u32(a.h())); }
+	__forceinline GSVector8i max_u32(const GSVector8i& a) const { return GSVector8i(l().max_u32(a.l()), h().max_u32(a.h())); }
+
+	__forceinline GSVector8i sat_i16(const GSVector8i& a, const GSVector8i& b) const { return max_i16(a).min_i16(b); }
+	__forceinline GSVector8i sat_i32(const GSVector8i& a, const GSVector8i& b) const { return max_i32(a).min_i32(b); }
+	__forceinline GSVector8i sat_u8(const GSVector8i& a, const GSVector8i& b) const { return max_u8(a).min_u8(b); }
+	__forceinline GSVector8i sat_u16(const GSVector8i& a, const GSVector8i& b) const { return max_u16(a).min_u16(b); }
+
+	__forceinline GSVector8i clamp8() const
+	{
+		return pu16().upl8();
+	}
+
+	__forceinline GSVector8i blend8(const GSVector8i& a, const GSVector8i& mask) const
+	{
+		return GSVector8i(l().blend8(a.l(), mask.l()), h().blend8(a.h(), mask.h()));
+	}
+
+	template <int mask>
+	__forceinline GSVector8i blend16(const GSVector8i& a) const
+	{
+		// vpblendw applies the same 8-bit mask to both lanes.
+		return GSVector8i(l().blend16<mask>(a.l()), h().blend16<mask>(a.h()));
+	}
+
+	template <int mask>
+	__forceinline GSVector8i blend32(const GSVector8i& a) const
+	{
+		return GSVector8i(l().blend32<mask & 0xf>(a.l()), h().blend32<(mask >> 4) & 0xf>(a.h()));
+	}
+
+	__forceinline GSVector8i blend(const GSVector8i& a, const GSVector8i& mask) const
+	{
+		return GSVector8i(l().blend(a.l(), mask.l()), h().blend(a.h(), mask.h()));
+	}
+
+	/// Equivalent to blend with the given mask broadcasted across the vector
+	/// May be faster than blend in some cases
+	template <u32 mask>
+	__forceinline GSVector8i smartblend(const GSVector8i& a) const
+	{
+		return GSVector8i(l().smartblend<mask>(a.l()), h().smartblend<mask>(a.h()));
+	}
+
+	__forceinline GSVector8i mix16(const GSVector8i& a) const
+	{
+		return blend16<0xaa>(a);
+	}
+
+	__forceinline GSVector8i shuffle8(const GSVector8i& mask) const
+	{
+		return GSVector8i(l().shuffle8(mask.l()), h().shuffle8(mask.h()));
+	}
+
+	__forceinline GSVector8i ps16(const GSVector8i& a) const { return GSVector8i(l().ps16(a.l()), h().ps16(a.h())); }
+	__forceinline GSVector8i ps16() const { return ps16(*this); }
+	__forceinline GSVector8i pu16(const GSVector8i& a) const { return GSVector8i(l().pu16(a.l()), h().pu16(a.h())); }
+	__forceinline GSVector8i pu16() const { return pu16(*this); }
+	__forceinline GSVector8i ps32(const GSVector8i& a) const { return GSVector8i(l().ps32(a.l()), h().ps32(a.h())); }
+	__forceinline GSVector8i ps32() const { return ps32(*this); }
+	__forceinline GSVector8i pu32(const GSVector8i& a) const { return GSVector8i(l().pu32(a.l()), h().pu32(a.h())); }
+	__forceinline GSVector8i pu32() const { return pu32(*this); }
+
+	__forceinline GSVector8i upl8(const GSVector8i& a) const { return GSVector8i(l().upl8(a.l()), h().upl8(a.h())); }
+	__forceinline GSVector8i uph8(const GSVector8i& a) const { return GSVector8i(l().uph8(a.l()), h().uph8(a.h())); }
+	__forceinline GSVector8i upl16(const GSVector8i& a) const { return GSVector8i(l().upl16(a.l()), h().upl16(a.h())); }
+	__forceinline GSVector8i uph16(const GSVector8i& a) const { return GSVector8i(l().uph16(a.l()), h().uph16(a.h())); }
+	__forceinline GSVector8i upl32(const GSVector8i& a) const { return GSVector8i(l().upl32(a.l()), h().upl32(a.h())); }
+	__forceinline GSVector8i uph32(const GSVector8i& a) const { return GSVector8i(l().uph32(a.l()), h().uph32(a.h())); }
+	__forceinline GSVector8i upl64(const GSVector8i& a) const { return GSVector8i(l().upl64(a.l()), h().upl64(a.h())); }
+	__forceinline GSVector8i uph64(const GSVector8i& a) const { return GSVector8i(l().uph64(a.l()), h().uph64(a.h())); }
+
+	__forceinline GSVector8i upl8() const { return GSVector8i(l().upl8(), h().upl8()); }
+	__forceinline GSVector8i uph8() const { return GSVector8i(l().uph8(), h().uph8()); }
+	__forceinline GSVector8i upl16() const { return GSVector8i(l().upl16(), h().upl16()); }
+	__forceinline GSVector8i uph16() const { return GSVector8i(l().uph16(), h().uph16()); }
+	__forceinline GSVector8i upl32() const { return GSVector8i(l().upl32(), h().upl32()); }
+	__forceinline GSVector8i uph32() const { return GSVector8i(l().uph32(), h().uph32()); }
+	__forceinline GSVector8i upl64() const { return GSVector8i(l().upl64(), h().upl64()); }
+	__forceinline GSVector8i uph64() const { return GSVector8i(l().uph64(), h().uph64()); }
+
+	// cross lane! from 128-bit to full 256-bit range
+
+	static __forceinline GSVector8i i8to16(const GSVector4i& v) { return GSVector8i(v.i8to16(), v.srl<8>().i8to16()); }
+	static __forceinline GSVector8i u8to16(const GSVector4i& v) { return GSVector8i(v.u8to16(), v.srl<8>().u8to16()); }
+	static __forceinline GSVector8i i8to32(const GSVector4i& v) { return GSVector8i(v.i8to32(), v.srl<4>().i8to32()); }
+	static __forceinline GSVector8i u8to32(const GSVector4i& v) { return GSVector8i(v.u8to32(), v.srl<4>().u8to32()); }
+	static __forceinline GSVector8i i16to32(const GSVector4i& v) { return GSVector8i(v.i16to32(), v.srl<8>().i16to32()); }
+	static __forceinline GSVector8i u16to32(const GSVector4i& v) { return GSVector8i(v.u16to32(), v.srl<8>().u16to32()); }
+	static __forceinline GSVector8i i32to64(const GSVector4i& v) { return GSVector8i(v.i32to64(), v.srl<8>().i32to64()); }
+	static __forceinline GSVector8i u32to64(const GSVector4i& v) { return GSVector8i(v.u32to64(), v.srl<8>().u32to64()); }
+
+	//
+
+	template <int i>
+	__forceinline GSVector8i srl() const
+	{
+		return GSVector8i(l().srl<i>(), h().srl<i>());
+	}
+
+	template <int i>
+	__forceinline GSVector8i srl(const GSVector8i& v)
+	{
+		return GSVector8i(l().srl<i>(v.l()), h().srl<i>(v.h()));
+	}
+
+	template <int i>
+	__forceinline GSVector8i sll() const
+	{
+		return GSVector8i(l().sll<i>(), h().sll<i>());
+	}
+
+	template <int i>
+	__forceinline GSVector8i sra16() const { return GSVector8i(l().sra16<i>(), h().sra16<i>()); }
+	template <int i>
+	__forceinline GSVector8i sra32() const { return GSVector8i(l().sra32<i>(), h().sra32<i>()); }
+	template <int i>
+	__forceinline GSVector8i sll16() const { return GSVector8i(l().sll16<i>(), h().sll16<i>()); }
+	template <int i>
+	__forceinline GSVector8i sll32() const { return GSVector8i(l().sll32<i>(), h().sll32<i>()); }
+	template <int i>
+	__forceinline GSVector8i sll64() const { return GSVector8i(l().sll64<i>(), h().sll64<i>()); }
+	template <int i>
+	__forceinline GSVector8i srl16() const { return GSVector8i(l().srl16<i>(), h().srl16<i>()); }
+	template <int i>
+	__forceinline GSVector8i srl32() const { return GSVector8i(l().srl32<i>(), h().srl32<i>()); }
+	template <int i>
+	__forceinline GSVector8i srl64() const { return GSVector8i(l().srl64<i>(), h().srl64<i>()); }
+
+	__forceinline GSVector8i srav32(const GSVector8i& i) const { return GSVector8i(l().srav32(i.l()), h().srav32(i.h())); }
+	__forceinline GSVector8i sllv32(const GSVector8i& i) const { return GSVector8i(l().sllv32(i.l()), h().sllv32(i.h())); }
+	__forceinline GSVector8i srlv32(const GSVector8i& i) const { return GSVector8i(l().srlv32(i.l()), h().srlv32(i.h())); }
+
+	__forceinline GSVector8i add8(const GSVector8i& v) const { return GSVector8i(l().add8(v.l()), h().add8(v.h())); }
+	__forceinline GSVector8i add16(const GSVector8i& v) const { return GSVector8i(l().add16(v.l()), h().add16(v.h())); }
+	__forceinline GSVector8i add32(const GSVector8i& v) const { return GSVector8i(l().add32(v.l()), h().add32(v.h())); }
+	__forceinline GSVector8i adds8(const GSVector8i& v) const { return GSVector8i(l().adds8(v.l()), h().adds8(v.h())); }
+	__forceinline GSVector8i adds16(const GSVector8i& v) const { return GSVector8i(l().adds16(v.l()), h().adds16(v.h())); }
+	__forceinline GSVector8i hadds16(const GSVector8i& v) const { return GSVector8i(l().hadds16(v.l()), h().hadds16(v.h())); }
+	__forceinline GSVector8i addus8(const GSVector8i& v) const { return GSVector8i(l().addus8(v.l()), h().addus8(v.h())); }
+	__forceinline GSVector8i addus16(const GSVector8i& v) const { return GSVector8i(l().addus16(v.l()), h().addus16(v.h())); }
+	__forceinline GSVector8i sub8(const GSVector8i& v) const { return GSVector8i(l().sub8(v.l()), h().sub8(v.h())); }
+	__forceinline GSVector8i sub16(const GSVector8i& v) const { return GSVector8i(l().sub16(v.l()), h().sub16(v.h())); }
+	__forceinline GSVector8i sub32(const GSVector8i& v) const { return GSVector8i(l().sub32(v.l()), h().sub32(v.h())); }
+	__forceinline GSVector8i subs8(const GSVector8i& v) const { return GSVector8i(l().subs8(v.l()), h().subs8(v.h())); }
+	__forceinline GSVector8i subs16(const GSVector8i& v) const { return GSVector8i(l().subs16(v.l()), h().subs16(v.h())); }
+	__forceinline GSVector8i subus8(const GSVector8i& v) const { return GSVector8i(l().subus8(v.l()), h().subus8(v.h())); }
+	__forceinline GSVector8i subus16(const GSVector8i& v) const { return GSVector8i(l().subus16(v.l()), h().subus16(v.h())); }
+	__forceinline GSVector8i avg8(const GSVector8i& v) const { return GSVector8i(l().avg8(v.l()), h().avg8(v.h())); }
+	__forceinline GSVector8i avg16(const GSVector8i& v) const { return GSVector8i(l().avg16(v.l()), h().avg16(v.h())); }
+	__forceinline GSVector8i mul16hs(const GSVector8i& v) const { return GSVector8i(l().mul16hs(v.l()), h().mul16hs(v.h())); }
+	__forceinline GSVector8i mul16l(const GSVector8i& v) const { return GSVector8i(l().mul16l(v.l()), h().mul16l(v.h())); }
+	__forceinline GSVector8i mul16hrs(const GSVector8i& v) const { return GSVector8i(l().mul16hrs(v.l()), h().mul16hrs(v.h())); }
+
+	__forceinline bool eq(const GSVector8i& v) const
+	{
+		return (vmaxvq_u32(vreinterpretq_u32_s32(vorrq_s32(veorq_s32(v4s[0], v.v4s[0]), veorq_s32(v4s[1], v.v4s[1])))) == 0);
+	}
+
+	__forceinline GSVector8i eq8(const GSVector8i& v) const { return GSVector8i(l().eq8(v.l()), h().eq8(v.h())); }
+	__forceinline GSVector8i eq16(const GSVector8i& v) const { return GSVector8i(l().eq16(v.l()), h().eq16(v.h())); }
+	__forceinline GSVector8i eq32(const GSVector8i& v) const { return GSVector8i(l().eq32(v.l()), h().eq32(v.h())); }
+	__forceinline GSVector8i neq8(const GSVector8i& v) const { return GSVector8i(l().neq8(v.l()), h().neq8(v.h())); }
+	__forceinline GSVector8i neq16(const GSVector8i& v) const { return GSVector8i(l().neq16(v.l()), h().neq16(v.h())); }
+	__forceinline GSVector8i neq32(const GSVector8i& v) const { return GSVector8i(l().neq32(v.l()), h().neq32(v.h())); }
+	__forceinline GSVector8i gt8(const GSVector8i& v) const { return GSVector8i(l().gt8(v.l()), h().gt8(v.h())); }
+	__forceinline GSVector8i gt16(const GSVector8i& v) const { return GSVector8i(l().gt16(v.l()), h().gt16(v.h())); }
+	__forceinline GSVector8i gt32(const GSVector8i& v) const { return GSVector8i(l().gt32(v.l()), h().gt32(v.h())); }
+	__forceinline GSVector8i lt8(const GSVector8i& v) const { return GSVector8i(l().lt8(v.l()), h().lt8(v.h())); }
+	__forceinline GSVector8i lt16(const GSVector8i& v) const { return GSVector8i(l().lt16(v.l()), h().lt16(v.h())); }
+	__forceinline GSVector8i lt32(const GSVector8i& v) const { return GSVector8i(l().lt32(v.l()), h().lt32(v.h())); }
+
+	__forceinline GSVector8i andnot(const GSVector8i& v) const { return GSVector8i(l().andnot(v.l()), h().andnot(v.h())); }
+
+	__forceinline int mask() const
+	{
+		return l().mask() | (h().mask() << 16);
+	}
+
+	__forceinline bool alltrue() const
+	{
+		// MSB should be set in all 8-bit lanes.
+		return (vminvq_u8(vandq_u8(vreinterpretq_u8_s32(v4s[0]), vreinterpretq_u8_s32(v4s[1]))) & 0x80) == 0x80;
+	}
+
+	__forceinline bool allfalse() const
+	{
+		// MSB should be clear in all 8-bit lanes.
+		return (vmaxvq_u8(vorrq_u8(vreinterpretq_u8_s32(v4s[0]), vreinterpretq_u8_s32(v4s[1]))) & 0x80) != 0x80;
+	}
+
+	template <int i>
+	__forceinline int extract32() const
+	{
+		static_assert(i < 8);
+		return vgetq_lane_s32(v4s[i >> 2], i & 3);
+	}
+
+	template <int i>
+	__forceinline GSVector4i extract() const
+	{
+		static_assert(i < 2);
+		return GSVector4i(v4s[i]);
+	}
+
+	template <int i>
+	__forceinline GSVector8i insert(const GSVector4i& v) const
+	{
+		static_assert(i < 2);
+		return (i == 0) ? GSVector8i(v, h()) : GSVector8i(l(), v);
+	}
+
+	template <class T>
+	__forceinline GSVector8i gather32_32(const T* ptr) const
+	{
+		return GSVector8i(l().gather32_32(ptr), h().gather32_32(ptr));
+	}
+
+	template <class T1, class T2>
+	__forceinline GSVector8i gather32_32(const T1* ptr1, const T2* ptr2) const
+	{
+		return GSVector8i(l().gather32_32(ptr1, ptr2), h().gather32_32(ptr1, ptr2));
+	}
+
+	template <class T>
+	__forceinline void gather32_32(const T* RESTRICT ptr, GSVector8i* RESTRICT dst) const
+	{
+		dst[0] = gather32_32<>(ptr);
+	}
+
+	//
+
+	__forceinline static GSVector8i loadnt(const void* p)
+	{
+		return GSVector8i(GSVector4i::loadnt(p), GSVector4i::loadnt(static_cast<const u8*>(p) + 16));
+	}
+
+	__forceinline static GSVector8i loadl(const void* p)
+	{
+		return GSVector8i(vld1q_s32(static_cast<const int32_t*>(p)), vdupq_n_s32(0));
+	}
+
+	__forceinline static GSVector8i loadh(const void* p)
+	{
+		return GSVector8i(vdupq_n_s32(0), vld1q_s32(static_cast<const int32_t*>(p)));
+	}
+
+	__forceinline static GSVector8i loadh(const void* p, const GSVector8i& v)
+	{
+		return GSVector8i(v.v4s[0], vld1q_s32(static_cast<const int32_t*>(p)));
+	}
+
+	__forceinline static GSVector8i load(const void* pl, const void* ph)
+	{
+		return GSVector8i(vld1q_s32(static_cast<const int32_t*>(pl)), vld1q_s32(static_cast<const int32_t*>(ph)));
+	}
+
+	__forceinline static GSVector8i load(const void* pll, const void* plh, const void* phl, const void* phh)
+	{
+		return GSVector8i(GSVector4i::load(pll, plh), GSVector4i::load(phl, phh));
+	}
+
+	template <bool aligned>
+	__forceinline static GSVector8i load(const void* p)
+	{
+		const int32x4x2_t v = vld1q_s32_x2(static_cast<const int32_t*>(p));
+		return GSVector8i(v.val[0], v.val[1]);
+	}
+
+	__forceinline static GSVector8i load(int i)
+	{
+		return GSVector8i(GSVector4i::load(i), GSVector4i::zero());
+	}
+
+	__forceinline static GSVector8i loadq(s64 i)
+	{
+		return GSVector8i(GSVector4i::loadq(i), GSVector4i::zero());
+	}
+
+	__forceinline static void storent(void* p, const GSVector8i& v)
+	{
+		GSVector4i::storent(p, v.l());
+		GSVector4i::storent(static_cast<u8*>(p) + 16, v.h());
+	}
+
+	__forceinline static void storel(void* p, const GSVector8i& v)
+	{
+		vst1q_s32(static_cast<int32_t*>(p), v.v4s[0]);
+	}
+
+	__forceinline static void storeh(void* p, const GSVector8i& v)
+	{
+		vst1q_s32(static_cast<int32_t*>(p), v.v4s[1]);
+	}
+
+	__forceinline static void store(void* pl, void* ph, const GSVector8i& v)
+	{
+		GSVector8i::storel(pl, v);
+		GSVector8i::storeh(ph, v);
+	}
+
+	template <bool aligned>
+	__forceinline static void store(void* p, const GSVector8i& v)
+	{
+		vst1q_s32_x2(static_cast<int32_t*>(p), int32x4x2_t{{v.v4s[0], v.v4s[1]}});
+	}
+
+	__forceinline static int store(const GSVector8i& v)
+	{
+		return vgetq_lane_s32(v.v4s[0], 0);
+	}
+
+	__forceinline static s64 storeq(const GSVector8i& v)
+	{
+		return vgetq_lane_s64(vreinterpretq_s64_s32(v.v4s[0]), 0);
+	}
+
+	__forceinline static void storent(void* RESTRICT dst, const void* RESTRICT src, size_t size)
+	{
+		GSVector4i::storent(dst, src, size);
+	}
+
+	__forceinline static void mix4(GSVector8i& a, GSVector8i& b)
+	{
+		GSVector8i mask(0x0f0f0f0f);
+
+		GSVector8i c = (b << 4).blend(a, mask);
+		GSVector8i d = b.blend(a >> 4, mask);
+		a = c;
+		b = d;
+	}
+
+	__forceinline static void sw8(GSVector8i& a, GSVector8i& b)
+	{
+		GSVector8i c = a;
+		GSVector8i d = b;
+
+		a = c.upl8(d);
+		b = c.uph8(d);
+	}
+
+	__forceinline static void sw16(GSVector8i& a, GSVector8i& b)
+	{
+		GSVector8i c = a;
+		GSVector8i d = b;
+
+		a = c.upl16(d);
+		b = c.uph16(d);
+	}
+
+	__forceinline static void sw32(GSVector8i& a, GSVector8i& b)
+	{
+		GSVector8i c = a;
+		GSVector8i d = b;
+
+		a = c.upl32(d);
+		b = c.uph32(d);
+	}
+
+	__forceinline static void sw32_inv(GSVector8i& a, GSVector8i& b);
+
+	__forceinline static void sw64(GSVector8i& a, GSVector8i& b)
+	{
+		GSVector8i c = a;
+		GSVector8i d = b;
+
+		a = c.upl64(d);
+		b = c.uph64(d);
+	}
+
+	__forceinline static void sw128(GSVector8i& a, GSVector8i& b)
+	{
+		// Free on NEON, the halves are separate registers.
+		const int32x4_t c = a.v4s[1];
+		a.v4s[1] = b.v4s[0];
+		b.v4s[0] = c;
+	}
+
+	__forceinline static void sw4(GSVector8i& a, GSVector8i& b, GSVector8i& c, GSVector8i& d)
+	{
+		GSVector8i mask(0x0f0f0f0f);
+
+		GSVector8i e = (b << 4).blend(a, mask);
+		GSVector8i f = b.blend(a >> 4, mask);
+		GSVector8i g = (d << 4).blend(c, mask);
+		GSVector8i h = d.blend(c >> 4, mask);
+
+		a = e.upl8(f);
+		c = e.uph8(f);
+		b = g.upl8(h);
+		d = g.uph8(h);
+	}
+
+	__forceinline static void sw8(GSVector8i& a, GSVector8i& b, GSVector8i& c, GSVector8i& d)
+	{
+		GSVector8i e = a;
+		GSVector8i f = c;
+
+		a = e.upl8(b);
+		c = e.uph8(b);
+		b = f.upl8(d);
+		d = f.uph8(d);
+	}
+
+	__forceinline static void sw16(GSVector8i& a, GSVector8i& b, GSVector8i& c, GSVector8i& d)
+	{
+		GSVector8i e = a;
+		GSVector8i f = c;
+
+		a = e.upl16(b);
+		c = e.uph16(b);
+		b = f.upl16(d);
+		d = f.uph16(d);
+	}
+
+	__forceinline static void sw32(GSVector8i& a, GSVector8i& b, GSVector8i& c, GSVector8i& d)
+	{
+		GSVector8i e = a;
+		GSVector8i f = c;
+
+		a = e.upl32(b);
+		c = e.uph32(b);
+		b = f.upl32(d);
+		d = f.uph32(d);
+	}
+
+	__forceinline static void sw64(GSVector8i& a, GSVector8i& b, GSVector8i& c, GSVector8i& d)
+	{
+		GSVector8i e = a;
+		GSVector8i f = c;
+
+		a = e.upl64(b);
+		c = e.uph64(b);
+		b = f.upl64(d);
+		d = f.uph64(d);
+	}
+
+	__forceinline static void sw128(GSVector8i& a, GSVector8i& b, GSVector8i& c, GSVector8i& d)
+	{
+		GSVector8i e = a;
+		GSVector8i f = c;
+
+		a = e.ac(b);
+		c = e.bd(b);
+		b = f.ac(d);
+		d = f.bd(d);
+	}
+
+	__forceinline void operator+=(const GSVector8i& v) { *this = add32(v); }
+	__forceinline void operator-=(const GSVector8i& v) { *this = sub32(v); }
+	__forceinline void operator+=(int i) { *this = add32(GSVector8i(i)); }
+	__forceinline void operator-=(int i) { *this = sub32(GSVector8i(i)); }
+	__forceinline void operator<<=(const int i) { *this = *this << i; }
+	__forceinline void operator>>=(const int i) { *this = *this >> i; }
+	__forceinline void operator&=(const GSVector8i& v) { *this = *this & v; }
+	__forceinline void operator|=(const GSVector8i& v) { *this = *this | v; }
+	__forceinline void operator^=(const GSVector8i& v) { *this = *this ^ v; }
+
+	__forceinline friend GSVector8i operator+(const GSVector8i& v1, const GSVector8i& v2) { return v1.add32(v2); }
+	__forceinline friend GSVector8i operator-(const GSVector8i& v1, const GSVector8i& v2) { return v1.sub32(v2); }
+	__forceinline friend GSVector8i operator+(const GSVector8i& v, int i) { return v.add32(GSVector8i(i)); }
+	__forceinline friend GSVector8i operator-(const GSVector8i& v, int i) { return v.sub32(GSVector8i(i)); }
+	__forceinline friend GSVector8i operator<<(const GSVector8i& v, const int i) { return GSVector8i(v.l() << i, v.h() << i); }
+	__forceinline friend GSVector8i operator>>(const GSVector8i& v, const int i) { return GSVector8i(v.l() >> i, v.h() >> i); }
+	__forceinline friend GSVector8i operator&(const GSVector8i& v1, const GSVector8i& v2) { return GSVector8i(vandq_s32(v1.v4s[0], v2.v4s[0]), vandq_s32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8i operator|(const GSVector8i& v1, const GSVector8i& v2) { return GSVector8i(vorrq_s32(v1.v4s[0], v2.v4s[0]), vorrq_s32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8i operator^(const GSVector8i& v1, const GSVector8i& v2) { return GSVector8i(veorq_s32(v1.v4s[0], v2.v4s[0]), veorq_s32(v1.v4s[1], v2.v4s[1])); }
+	__forceinline friend GSVector8i operator&(const GSVector8i& v, int i) { return v & GSVector8i(i); }
+	__forceinline friend GSVector8i operator|(const GSVector8i& v, int i) { return v | GSVector8i(i); }
+	__forceinline friend GSVector8i operator^(const GSVector8i& v, int i) { return v ^ GSVector8i(i); }
+	__forceinline friend GSVector8i operator~(const GSVector8i& v) { return GSVector8i(vmvnq_s32(v.v4s[0]), vmvnq_s32(v.v4s[1])); }
+
+	__forceinline friend GSVector8i operator==(const GSVector8i& v1, const GSVector8i& v2) { return v1.eq32(v2); }
+	__forceinline friend GSVector8i operator!=(const GSVector8i& v1, const GSVector8i& v2) { return v1.neq32(v2); }
+	__forceinline friend GSVector8i operator>(const GSVector8i& v1, const GSVector8i& v2) { return v1.gt32(v2); }
+	__forceinline friend GSVector8i operator<(const GSVector8i& v1, const GSVector8i& v2) { return v1.lt32(v2); }
+	__forceinline friend GSVector8i operator>=(const GSVector8i& v1, const GSVector8i& v2) { return (v1 > v2) | (v1 == v2); }
+	__forceinline friend GSVector8i operator<=(const GSVector8i& v1, const GSVector8i& v2) { return (v1 < v2) | (v1 == v2); }
+
+	// clang-format off
+
+	// x = v[31:0] / x = v[159:128]
+	// y = v[63:32] / y = v[191:160]
+	// z = v[95:64] / z = v[223:192]
+	// w = v[127:96] / w = v[255:224]
+
+	#define VECTOR8i_SHUFFLE_4(xs, xn, ys, yn, zs, zn, ws, wn) \
+		__forceinline GSVector8i xs##ys##zs##ws() const { return GSVector8i(__builtin_shufflevector(v4s[0], v4s[0], xn, yn, zn, wn), __builtin_shufflevector(v4s[1], v4s[1], xn, yn, zn, wn)); }
+
+	#define VECTOR8i_SHUFFLE_3(xs, xn, ys, yn, zs, zn) \
+		VECTOR8i_SHUFFLE_4(xs, xn, ys, yn, zs, zn, x, 0) \
+		VECTOR8i_SHUFFLE_4(xs, xn, ys, yn, zs, zn, y, 1) \
+		VECTOR8i_SHUFFLE_4(xs, xn, ys, yn, zs, zn, z, 2) \
+		VECTOR8i_SHUFFLE_4(xs, xn, ys, yn, zs, zn, w, 3) \
+
+	#define VECTOR8i_SHUFFLE_2(xs, xn, ys, yn) \
+		VECTOR8i_SHUFFLE_3(xs, xn, ys, yn, x, 0) \
+		VECTOR8i_SHUFFLE_3(xs, xn, ys, yn, y, 1) \
+		VECTOR8i_SHUFFLE_3(xs, xn, ys, yn, z, 2) \
+		VECTOR8i_SHUFFLE_3(xs, xn, ys, yn, w, 3) \
+
+	#define VECTOR8i_SHUFFLE_1(xs, xn) \
+		VECTOR8i_SHUFFLE_2(xs, xn, x, 0) \
+		VECTOR8i_SHUFFLE_2(xs, xn, y, 1) \
+		VECTOR8i_SHUFFLE_2(xs, xn, z, 2) \
+		VECTOR8i_SHUFFLE_2(xs, xn, w, 3) \
+
+	VECTOR8i_SHUFFLE_1(x, 0)
+	VECTOR8i_SHUFFLE_1(y, 1)
+	VECTOR8i_SHUFFLE_1(z, 2)
+	VECTOR8i_SHUFFLE_1(w, 3)
+
+	// a = v0[127:0]
+	// b = v0[255:128]
+	// c = v1[127:0]
+	// d = v1[255:128]
+	// _ = 0
+
+	#define VECTOR8i_PERMUTE128_2(as, an, bs, bn) \
+		__forceinline GSVector8i as##bs() const { return GSVector8i(sel128<an>(*this), sel128<bn>(*this)); } \
+		__forceinline GSVector8i as##bs(const GSVector8i& v) const { return GSVector8i(sel128<an>(v), sel128<bn>(v)); } \
+
+	#define VECTOR8i_PERMUTE128_1(as, an) \
+		VECTOR8i_PERMUTE128_2(as, an, a, 0) \
+		VECTOR8i_PERMUTE128_2(as, an, b, 1) \
+		VECTOR8i_PERMUTE128_2(as, an, c, 2) \
+		VECTOR8i_PERMUTE128_2(as, an, d, 3) \
+		VECTOR8i_PERMUTE128_2(as, an, _, 8) \
+
+	VECTOR8i_PERMUTE128_1(a, 0)
+	VECTOR8i_PERMUTE128_1(b, 1)
+	VECTOR8i_PERMUTE128_1(c, 2)
+	VECTOR8i_PERMUTE128_1(d, 3)
+	VECTOR8i_PERMUTE128_1(_, 8)
+
+	// a = v[63:0]
+	// b = v[127:64]
+	// c = v[191:128]
+	// d = v[255:192]
+
+	#define VECTOR8i_PERMUTE64_4(as, an, bs, bn, cs, cn, ds, dn) \
+		__forceinline GSVector8i as##bs##cs##ds() const { return permute64<an, bn, cn, dn>(); } \
+
+	#define VECTOR8i_PERMUTE64_3(as, an, bs, bn, cs, cn) \
+		VECTOR8i_PERMUTE64_4(as, an, bs, bn, cs, cn, a, 0) \
+		VECTOR8i_PERMUTE64_4(as, an, bs, bn, cs, cn, b, 1) \
+		VECTOR8i_PERMUTE64_4(as, an, bs, bn, cs, cn, c, 2) \
+		VECTOR8i_PERMUTE64_4(as, an, bs, bn, cs, cn, d, 3) \
+
+	#define VECTOR8i_PERMUTE64_2(as, an, bs, bn) \
+		VECTOR8i_PERMUTE64_3(as, an, bs, bn, a, 0) \
+		VECTOR8i_PERMUTE64_3(as, an, bs, bn, b, 1) \
+		VECTOR8i_PERMUTE64_3(as, an, bs, bn, c, 2) \
+		VECTOR8i_PERMUTE64_3(as, an, bs, bn, d, 3) \
+
+	#define VECTOR8i_PERMUTE64_1(as, an) \
+		VECTOR8i_PERMUTE64_2(as, an, a, 0) \
+		VECTOR8i_PERMUTE64_2(as, an, b, 1) \
+		VECTOR8i_PERMUTE64_2(as, an, c, 2) \
+		VECTOR8i_PERMUTE64_2(as, an, d, 3) \
+
+	VECTOR8i_PERMUTE64_1(a, 0)
+	VECTOR8i_PERMUTE64_1(b, 1)
+	VECTOR8i_PERMUTE64_1(c, 2)
+	VECTOR8i_PERMUTE64_1(d, 3)
+
+	// clang-format on
+
+	__forceinline static GSVector8i broadcast128(const GSVector4i& v)
+	{
+		return GSVector8i(v);
+	}
+
+	__forceinline static GSVector8i broadcast32(const GSVector4i& v)
+	{
+		const int32x4_t x = vdupq_laneq_s32(v.v4s, 0);
+		return GSVector8i(x, x);
+	}
+
+	__forceinline static GSVector8i zero() { return GSVector8i(vdupq_n_s32(0), vdupq_n_s32(0)); }
+
+	// clang-format off
+
+	#define VECTOR8i_CONSTANT(name) \
+		__forceinline static GSVector8i name() { return GSVector8i(GSVector4i::name()); }
+
+	VECTOR8i_CONSTANT(xffffffff)
+
+	VECTOR8i_CONSTANT(x00000001) VECTOR8i_CONSTANT(x00000003) VECTOR8i_CONSTANT(x00000007) VECTOR8i_CONSTANT(x0000000f)
+	VECTOR8i_CONSTANT(x0000001f) VECTOR8i_CONSTANT(x0000003f) VECTOR8i_CONSTANT(x0000007f) VECTOR8i_CONSTANT(x000000ff)
+	VECTOR8i_CONSTANT(x000001ff) VECTOR8i_CONSTANT(x000003ff) VECTOR8i_CONSTANT(x000007ff) VECTOR8i_CONSTANT(x00000fff)
+	VECTOR8i_CONSTANT(x00001fff) VECTOR8i_CONSTANT(x00003fff) VECTOR8i_CONSTANT(x00007fff) VECTOR8i_CONSTANT(x0000ffff)
+	VECTOR8i_CONSTANT(x0001ffff) VECTOR8i_CONSTANT(x0003ffff) VECTOR8i_CONSTANT(x0007ffff) VECTOR8i_CONSTANT(x000fffff)
+	VECTOR8i_CONSTANT(x001fffff) VECTOR8i_CONSTANT(x003fffff) VECTOR8i_CONSTANT(x007fffff) VECTOR8i_CONSTANT(x00ffffff)
+	VECTOR8i_CONSTANT(x01ffffff) VECTOR8i_CONSTANT(x03ffffff) VECTOR8i_CONSTANT(x07ffffff) VECTOR8i_CONSTANT(x0fffffff)
+	VECTOR8i_CONSTANT(x1fffffff) VECTOR8i_CONSTANT(x3fffffff) VECTOR8i_CONSTANT(x7fffffff)
+
+	VECTOR8i_CONSTANT(x80000000) VECTOR8i_CONSTANT(xc0000000) VECTOR8i_CONSTANT(xe0000000) VECTOR8i_CONSTANT(xf0000000)
+	VECTOR8i_CONSTANT(xf8000000) VECTOR8i_CONSTANT(xfc000000) VECTOR8i_CONSTANT(xfe000000) VECTOR8i_CONSTANT(xff000000)
+	VECTOR8i_CONSTANT(xff800000) VECTOR8i_CONSTANT(xffc00000) VECTOR8i_CONSTANT(xffe00000) VECTOR8i_CONSTANT(xfff00000)
+	VECTOR8i_CONSTANT(xfff80000) VECTOR8i_CONSTANT(xfffc0000) VECTOR8i_CONSTANT(xfffe0000) VECTOR8i_CONSTANT(xffff0000)
+	VECTOR8i_CONSTANT(xffff8000) VECTOR8i_CONSTANT(xffffc000) VECTOR8i_CONSTANT(xffffe000) VECTOR8i_CONSTANT(xfffff000)
+	VECTOR8i_CONSTANT(xfffff800) VECTOR8i_CONSTANT(xfffffc00) VECTOR8i_CONSTANT(xfffffe00) VECTOR8i_CONSTANT(xffffff00)
+	VECTOR8i_CONSTANT(xffffff80) VECTOR8i_CONSTANT(xffffffc0) VECTOR8i_CONSTANT(xffffffe0) VECTOR8i_CONSTANT(xfffffff0)
+	VECTOR8i_CONSTANT(xfffffff8) VECTOR8i_CONSTANT(xfffffffc) VECTOR8i_CONSTANT(xfffffffe)
+
+	VECTOR8i_CONSTANT(x0001) VECTOR8i_CONSTANT(x0003) VECTOR8i_CONSTANT(x0007) VECTOR8i_CONSTANT(x000f)
+	VECTOR8i_CONSTANT(x001f) VECTOR8i_CONSTANT(x003f) VECTOR8i_CONSTANT(x007f) VECTOR8i_CONSTANT(x00ff)
+	VECTOR8i_CONSTANT(x01ff) VECTOR8i_CONSTANT(x03ff) VECTOR8i_CONSTANT(x07ff) VECTOR8i_CONSTANT(x0fff)
+	VECTOR8i_CONSTANT(x1fff) VECTOR8i_CONSTANT(x3fff) VECTOR8i_CONSTANT(x7fff)
+
+	VECTOR8i_CONSTANT(x8000) VECTOR8i_CONSTANT(xc000) VECTOR8i_CONSTANT(xe000) VECTOR8i_CONSTANT(xf000)
+	VECTOR8i_CONSTANT(xf800) VECTOR8i_CONSTANT(xfc00) VECTOR8i_CONSTANT(xfe00) VECTOR8i_CONSTANT(xff00)
+	VECTOR8i_CONSTANT(xff80) VECTOR8i_CONSTANT(xffc0) VECTOR8i_CONSTANT(xffe0) VECTOR8i_CONSTANT(xfff0)
+	VECTOR8i_CONSTANT(xfff8) VECTOR8i_CONSTANT(xfffc) VECTOR8i_CONSTANT(xfffe)
+
+	#undef VECTOR8i_CONSTANT
+
+	// clang-format on
+};
@@ -7,6 +7,8 @@
 
 #include "cpuinfo.h"
 
+#include <algorithm>
+
 #ifdef _WIN32
 #define strcasecmp _stricmp
 #endif
@@ -43,6 +45,46 @@ static ProcessorFeatures::VectorISA getCurrentISA()
 		return ProcessorFeatures::VectorISA::SSE4;
 }
 
+#elif defined(_M_ARM64)
+
+static ProcessorFeatures::VectorISA getCurrentISA()
+{
+	// For debugging
+	if (const char* over = getenv("OVERRIDE_VECTOR_ISA"))
+	{
+		if (strcasecmp(over, "neon256") == 0)
+		{
+			fprintf(stderr, "Vector ISA Override: NEON256\n");
+			return ProcessorFeatures::VectorISA::NEON256;
+		}
+		if (strcasecmp(over, "neon") == 0)
+		{
+			fprintf(stderr, "Vector ISA Override: NEON\n");
+			return ProcessorFeatures::VectorISA::NEON;
+		}
+	}
+
+#ifdef MULTI_ISA_SHARED_COMPILATION
+	// Paired registers double the work per iteration, which only helps when there are enough
+	// vector pipes to issue both halves in parallel, and the core type doesn't tell us that
+	// reliably. Time the swizzle kernels of both variants instead, interleaved so they run on the
+	// same core at the same clocks, and keep the best run of each.
+	u64 neon = UINT64_MAX;
+	u64 neon256 = UINT64_MAX;
+	for (int i = 0; i < 3; i++)
+	{
+		neon = std::min(neon, isa_neon::GSBenchmarkSwizzle(32));
+		neon256 = std::min(neon256, isa_neon256::GSBenchmarkSwizzle(32));
+	}
+
+	// Register pairs cost more elsewhere (sampling, CLUT expansion), so require a clear win.
+	if (neon256 * 20 < neon * 19)
+		return ProcessorFeatures::VectorISA::NEON256;
+#endif
+
+	return ProcessorFeatures::VectorISA::NEON;
+}
+
 #endif
 
 static ProcessorFeatures getProcessorFeatures()
@@ -79,6 +121,8 @@ static ProcessorFeatures getProcessorFeatures()
 			features.hasSlowGather = true;
 		}
 	}
+#elif defined(_M_ARM64)
+	features.vectorISA = getCurrentISA();
 #endif
 	return features;
 }
@@ -9,6 +9,7 @@
 // For multiple-isa compilation
 #ifdef MULTI_ISA_UNSHARED_COMPILATION
 	// Preprocessor should have MULTI_ISA_UNSHARED_COMPILATION defined to `isa_sse4`, `isa_avx`, or `isa_avx2`
+	// (`isa_neon` or `isa_neon256` on ARM64)
 	#define CURRENT_ISA MULTI_ISA_UNSHARED_COMPILATION
 #else
 	// Define to isa_native in shared section in addition to multi-isa-off so if someone tries to use it they'll hopefully get a linker error and notice
@@ -49,12 +50,29 @@ struct ProcessorFeatures
 	VectorISA vectorISA;
 	bool hasFMA;
 	bool hasSlowGather;
+#elif defined(_M_ARM64)
+	/// NEON256 runs the GSVector8/GSVector8i kernels on register pairs, which only pays off on wide cores.
+	/// Chosen by timing GSBenchmarkSwizzle() for both variants at startup.
+	enum class VectorISA { NEON, NEON256 };
+	VectorISA vectorISA;
 #endif
 };
 
 extern const ProcessorFeatures g_cpu;
 
-#if defined(MULTI_ISA_UNSHARED_COMPILATION) || defined(MULTI_ISA_SHARED_COMPILATION)
+#if (defined(MULTI_ISA_UNSHARED_COMPILATION) || defined(MULTI_ISA_SHARED_COMPILATION)) && defined(_M_ARM64)
+	#define MULTI_ISA_DEF(...) \
+		namespace isa_neon    { __VA_ARGS__ } \
+		namespace isa_neon256 { __VA_ARGS__ }
+
+	#define MULTI_ISA_FRIEND(klass) \
+		friend class isa_neon   ::klass; \
+		friend class isa_neon256::klass;
+
+	#define MULTI_ISA_SELECT(fn) (\
+		::g_cpu.vectorISA == ProcessorFeatures::VectorISA::NEON256 ? isa_neon256::fn : \
+		                                                             isa_neon   ::fn)
+#elif defined(MULTI_ISA_UNSHARED_COMPILATION) || defined(MULTI_ISA_SHARED_COMPILATION)
 	#define MULTI_ISA_DEF(...) \
 		namespace isa_sse4 { __VA_ARGS__ } \
 		namespace isa_avx  { __VA_ARGS__ } \
@@ -77,6 +95,9 @@ extern const ProcessorFeatures g_cpu;
 
 class GSRenderer;
 MULTI_ISA_DEF(GSRenderer* makeGSRendererSW(int threads);)
+/// Round-trips a page of blocks through the GSBlock swizzle kernels <iterations> times and returns the
+/// elapsed Common::Timer ticks. Used to pick the vector ISA on ARM64 and by pcsx2-gsrunner.
+MULTI_ISA_DEF(u64 GSBenchmarkSwizzle(u32 iterations);)
 
 namespace MultiISAFunctions
 {
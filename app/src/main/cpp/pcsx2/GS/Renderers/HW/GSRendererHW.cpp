@@ -45,22 +45,26 @@ GSRendererHW::~GSRendererHW()
 
 void GSRendererHW::Destroy()
 {
+	m_pending_uploads.clear();
 	g_texture_cache->RemoveAll(true, true, true);
 	GSRenderer::Destroy();
 }
 
 void GSRendererHW::PurgeTextureCache(bool sources, bool targets, bool hash_cache)
 {
+	FlushPendingUploads();
 	g_texture_cache->RemoveAll(sources, targets, hash_cache);
 }
 
 void GSRendererHW::ReadbackTextureCache()
 {
+	FlushPendingUploads();
 	g_texture_cache->ReadbackAll();
 }
 
 GSTexture* GSRendererHW::LookupPaletteSource(u32 CBP, u32 CPSM, u32 CBW, GSVector2i& offset, float* scale, const GSVector2i& size)
 {
+	FlushPendingUploads();
 	return g_texture_cache->LookupPaletteSource(CBP, CPSM, CBW, offset, scale, size);
 }
 
@@ -76,6 +80,8 @@ float GSRendererHW::GetUpscaleMultiplier()
 
 void GSRendererHW::Reset(bool hardware_reset)
 {
+	FlushPendingUploads();
+
 	// Read back on CSR Reset, conditional downloading on render swap etc handled elsewhere.
 	if (!hardware_reset)
 		g_texture_cache->ReadbackAll();
@@ -94,6 +100,8 @@ void GSRendererHW::UpdateSettings(const Pcsx2Config::GSOptions& old_config)
 
 void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame)
 {
+	FlushPendingUploads();
+
 	if (GSConfig.LoadTextureReplacements)
 		GSTextureReplacements::ProcessAsyncLoadedTextures();
 
@@ -145,6 +153,8 @@ void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame)
 
 GSTexture* GSRendererHW::GetOutput(int i, float& scale, int& y_offset)
 {
+	FlushPendingUploads();
+
 	int index = i >= 0 ? i : 1;
 
 	GSPCRTCRegs::PCRTCDisplay& curFramebuffer = PCRTCDisplays.PCRTCDisplays[index];
@@ -189,6 +199,8 @@ GSTexture* GSRendererHW::GetOutput(int i, float& scale, int& y_offset)
 
 GSTexture* GSRendererHW::GetFeedbackOutput(float& scale)
 {
+	FlushPendingUploads();
+
 	const int index = m_regs->EXTBUF.FBIN & 1;
 	const GSVector2i fb_size(PCRTCDisplays.GetFramebufferSize(index));
 
@@ -1723,7 +1735,52 @@ void GSRendererHW::HandleManualDeswizzle()
 	ReplaceVerticesWithSprite(m_r, tex_rect, GSVector2i(1 << m_cached_ctx.TEX0.TW, 1 << m_cached_ctx.TEX0.TH), m_context->scissor.in);
 }
 
+/// Grows dst to cover r if the union of the two is exactly their combined area, i.e. still a rectangle.
+static bool TryMergeUploadRect(GSVector4i& dst, const GSVector4i& r)
+{
+	const auto area = [](const GSVector4i& v) { return v.rempty() ? 0 : static_cast<s64>(v.width()) * v.height(); };
+
+	const GSVector4i u = dst.runion(r);
+	if (area(u) != (area(dst) + area(r) - area(dst.rintersect(r))))
+		return false;
+
+	dst = u;
+	return true;
+}
+
 void GSRendererHW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r)
+{
+	if (!m_pending_uploads.empty())
+	{
+		GSUploadQueue& last = m_pending_uploads.back();
+		if (last.blit.DBP == BITBLTBUF.DBP && last.blit.DBW == BITBLTBUF.DBW && last.blit.DPSM == BITBLTBUF.DPSM &&
+			TryMergeUploadRect(last.rect, r))
+		{
+			GL_CACHE("HW: Merged upload %05x r(%d,%d,%d,%d) into r(%d,%d,%d,%d)", static_cast<u32>(BITBLTBUF.DBP),
+				r.x, r.y, r.z, r.w, last.rect.x, last.rect.y, last.rect.z, last.rect.w);
+			g_perfmon.Put(GSPerfMon::MergedUploads, 1);
+			return;
+		}
+
+		if (m_pending_uploads.size() >= MAX_PENDING_UPLOADS)
+			FlushPendingUploads();
+	}
+
+	m_pending_uploads.push_back({BITBLTBUF, r, s_n, false});
+}
+
+void GSRendererHW::FlushPendingUploads()
+{
+	if (m_pending_uploads.empty())
+		return;
+
+	for (const GSUploadQueue& upload : m_pending_uploads)
+		InvalidateVideoMemNow(upload.blit, upload.rect);
+
+	m_pending_uploads.clear();
+}
+
+void GSRendererHW::InvalidateVideoMemNow(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r)
 {
 	// printf("HW: [%d] InvalidateVideoMem %d,%d - %d,%d %05x (%d)\n", static_cast<int>(g_perfmon.GetFrame()), r.left, r.top, r.right, r.bottom, static_cast<int>(BITBLTBUF.DBP), static_cast<int>(BITBLTBUF.DPSM));
 
@@ -1767,6 +1824,8 @@ void GSRendererHW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 	if (clut)
 		return; // FIXME
 
+	FlushPendingUploads();
+
 	auto iter = m_draw_transfers.end();
 	bool skip = false;
 	// If the EE write overlaps the readback and was done since the last draw, there's no need to read it back.
@@ -1792,6 +1851,8 @@ void GSRendererHW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 
 void GSRendererHW::Move()
 {
+	FlushPendingUploads();
+
 	if (m_mv && m_mv(*this))
 	{
 		// Handled by HW hack.
@@ -2210,6 +2271,8 @@ void GSRendererHW::RoundSpriteOffset()
 
 void GSRendererHW::Draw()
 {
+	FlushPendingUploads();
+
 	if (GSConfig.SaveInfo && GSConfig.ShouldDump(s_n, g_perfmon.GetFrame()))
 	{
 		std::string s;
@@ -8746,6 +8809,9 @@ void GSRendererHW::ClearGSLocalMemory(const GSOffset& off, const GSVector4i& r,
 	GL_INS("HW: ClearGSLocalMemory(): %08X %d,%d => %d,%d @ BP %x BW %u %s", vert_color, r.x, r.y, r.z, r.w, off.bp(),
 		off.bw(), psm_str(off.psm()));
 
+	// Callers don't always invalidate the texture cache, but hashes of the old contents must not be reused.
+	g_texture_cache->InvalidatePageHashes(off, r);
+
 	const u32 psm = (off.psm() == PSMCT32 && m_cached_ctx.FRAME.FBMSK == 0xFF000000u) ? PSMCT24 : off.psm();
 	const int format = GSLocalMemory::m_psm[psm].fmt;
 
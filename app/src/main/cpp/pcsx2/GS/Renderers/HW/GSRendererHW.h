@@ -99,6 +99,10 @@ private:
 		bool can_scale_rt_alpha, bool& new_rt_alpha_scale);
 	void CleanupDraw(bool invalidate_temp_src);
 
+	/// Applies the texture cache invalidation for every queued EE upload, in the order they were made.
+	void FlushPendingUploads();
+	void InvalidateVideoMemNow(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r);
+
 	void EmulateTextureSampler(const GSTextureCache::Target* rt, const GSTextureCache::Target* ds,
 		GSTextureCache::Source* tex, const TextureMinMaxResult& tmm, GSDevice::RecycledTexture& src_copy);
 	void HandleTextureHazards(const GSTextureCache::Target* rt, const GSTextureCache::Target* ds,
@@ -189,6 +193,13 @@ private:
 	u32 m_split_clear_pages = 0; // if zero, inactive
 	u32 m_split_clear_color = 0;
 
+	/// EE uploads which have been written to local memory but not yet invalidated in the texture cache.
+	/// Games often send a texture as a run of small strips, consecutive uploads to the same buffer are merged
+	/// as long as their union is still exactly a rectangle, and the queue is flushed before the texture cache
+	/// is used for anything else.
+	static constexpr u32 MAX_PENDING_UPLOADS = 32;
+	std::vector<GSUploadQueue> m_pending_uploads;
+
 	bool m_userhacks_tcoffset = false;
 	float m_userhacks_tcoffset_x = 0.0f;
 	float m_userhacks_tcoffset_y = 0.0f;
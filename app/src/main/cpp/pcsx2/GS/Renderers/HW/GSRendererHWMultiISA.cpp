@@ -546,6 +546,10 @@ bool GSRendererHWFunctions::SwPrimRender(GSRendererHW& hw, bool invalidate_tc, b
 
 	if (invalidate_tc)
 		g_texture_cache->InvalidateVideoMem(context->offset.fb, bbox);
+	else if (fwrite)
+		g_texture_cache->InvalidatePageHashes(context->offset.fb, bbox);
+	if (zwrite)
+		g_texture_cache->InvalidatePageHashes(context->offset.zb, bbox);
 
 	// Jak does sw prim render, then draws to the same target, and it needs to be uploaded.
 	if (add_ee_transfer)
@@ -14,11 +14,18 @@
 #include "common/BitUtils.h"
 #include "common/HashCombine.h"
 #include "common/SmallString.h"
+#include "common/Threading.h"
 
+#include "cpuinfo.h"
 #include "fmt/format.h"
 
+#include <atomic>
 #include <cinttypes>
+#include <condition_variable>
+#include <functional>
 #include <math.h>
+#include <mutex>
+#include <thread>
 
 #ifdef __APPLE__
 #include <stdlib.h>
@@ -33,6 +40,105 @@ static u8* s_unswizzle_buffer;
 /// List of candidates for purging when the hash cache gets too large.
 static std::vector<std::pair<GSTextureCache::HashCacheMap::iterator, s32>> s_hash_cache_purge_list;
 
+namespace
+{
+	/// Small pool of threads for hashing large textures. The GS thread takes part in every job and
+	/// blocks until it completes, so local memory is never written while the workers read it.
+	class TextureHashPool
+	{
+	public:
+		explicit TextureHashPool(u32 num_workers);
+		~TextureHashPool();
+
+		/// Calls func(i) for every i in [0, count), spread across the workers and the calling thread.
+		void Run(u32 count, const std::function<void(u32)>& func);
+
+	private:
+		void WorkerThread();
+		void RunItems();
+
+		std::vector<std::thread> m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_work_cv;
+		std::condition_variable m_done_cv;
+		const std::function<void(u32)>* m_func = nullptr;
+		u32 m_count = 0;
+		u32 m_generation = 0;
+		u32 m_busy = 0;
+		bool m_shutdown = false;
+		std::atomic<u32> m_next{0};
+	};
+} // namespace
+
+static std::unique_ptr<TextureHashPool> s_hash_pool;
+
+TextureHashPool::TextureHashPool(u32 num_workers)
+{
+	m_threads.reserve(num_workers);
+	for (u32 i = 0; i < num_workers; i++)
+		m_threads.emplace_back(&TextureHashPool::WorkerThread, this);
+}
+
+TextureHashPool::~TextureHashPool()
+{
+	{
+		std::unique_lock lock(m_mutex);
+		m_shutdown = true;
+	}
+	m_work_cv.notify_all();
+
+	for (std::thread& thread : m_threads)
+		thread.join();
+}
+
+void TextureHashPool::Run(u32 count, const std::function<void(u32)>& func)
+{
+	{
+		std::unique_lock lock(m_mutex);
+		m_func = &func;
+		m_count = count;
+		m_next.store(0, std::memory_order_relaxed);
+		m_busy = static_cast<u32>(m_threads.size());
+		m_generation++;
+	}
+	m_work_cv.notify_all();
+
+	RunItems();
+
+	std::unique_lock lock(m_mutex);
+	m_done_cv.wait(lock, [this]() { return m_busy == 0; });
+	m_func = nullptr;
+}
+
+void TextureHashPool::WorkerThread()
+{
+	Threading::SetNameOfCurrentThread("GS Hash Worker");
+
+	u32 generation = 0;
+	std::unique_lock lock(m_mutex);
+	for (;;)
+	{
+		m_work_cv.wait(lock, [this, generation]() { return m_shutdown || m_generation != generation; });
+		if (m_shutdown)
+			break;
+
+		generation = m_generation;
+		lock.unlock();
+		RunItems();
+		lock.lock();
+
+		if (--m_busy == 0)
+			m_done_cv.notify_one();
+	}
+}
+
+void TextureHashPool::RunItems()
+{
+	u32 i;
+	while ((i = m_next.fetch_add(1, std::memory_order_relaxed)) < m_count)
+		(*m_func)(i);
+}
+
 #ifdef PCSX2_DEVBUILD
 // We can only set one texture name per command buffer, which would break our fancy texture cache RT/DS/texture naming.
 // So, when debug device is enabled, don't reuse any textures that are drawable.
@@ -63,6 +169,7 @@ GSTextureCache::~GSTextureCache()
 	RemoveAll(true, true, true);
 
 	s_hash_cache_purge_list = {};
+	s_hash_pool.reset();
 	_aligned_free(s_unswizzle_buffer);
 }
 
@@ -1306,6 +1413,7 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const bool is_color, const
 
 		bool found_t = false;
 		bool tex_merge_rt = false;
+		const BlockRange lookup_range = BlockRange::FromRect(bp, bw, psm, block_boundary_rect);
 		auto& list = m_dst[RenderTarget];
 		for (auto i = list.begin(); i != list.end(); ++i)
 		{
@@ -1314,7 +1422,7 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const bool is_color, const
 			if (t->m_used)
 			{
 				//const bool overlaps = t->Inside(bp, bw, psm, block_boundary_rect);
-				const bool overlaps = t->Overlaps(bp, bw, psm, block_boundary_rect);
+				const bool overlaps = t->Overlaps(lookup_range);
 				// Try to make sure the target has available what we need, be careful of self referencing frames with font in the alpha.
 				// Also is we have already found a target which we had to offset in to by using a region or exact address,
 				// it's probable that's more correct than being inside (Tomb Raider Legends + Project Snowblind)
@@ -2281,6 +2389,13 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(GIFRegTEX0 TEX0, const GSVe
 	// TODO: Move all frame stuff to its own routine too.
 	if (!is_frame)
 	{
+		// The draw's block range is the same for every target, so work it out once for the inside target checks.
+		const bool check_inside_targets = !min_rect.rempty() && GSConfig.UserHacks_TextureInsideRt >= GSTextureInRtMode::InsideTargets;
+		const bool shuffle_from_8bit = is_shuffle && src && GSLocalMemory::m_psm[src->m_TEX0.PSM].bpp == 8;
+		const BlockRange draw_range = check_inside_targets ? BlockRange::FromRect(bp, TEX0.TBW, TEX0.PSM, min_rect) : BlockRange{};
+		const BlockRange shuffle_draw_range = (check_inside_targets && shuffle_from_8bit) ?
+			BlockRange::FromRect(bp, TEX0.TBW, TEX0.PSM, min_rect + GSVector4i(0, 0, 0, 32)) : BlockRange{};
+
 		for (auto i = list.begin(); i != list.end();)
 		{
 			Target* t = *i;
@@ -2380,8 +2495,20 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(GIFRegTEX0 TEX0, const GSVe
 				}
 			}
 			// Probably pointing to half way through the target
-			else if (!min_rect.rempty() && GSConfig.UserHacks_TextureInsideRt >= GSTextureInRtMode::InsideTargets)
+			else if (check_inside_targets)
 			{
+				// if it's a shuffle, some games tend to offset back by a page, such as Tomb Raider, for no disernable reason, but it then causes problems.
+				// This can also happen horizontally (Catwoman moves everything one page left with shuffles), but this is too messy to deal with right now.
+				const bool overlaps = t->Overlaps(draw_range) || (shuffle_from_8bit && t->Overlaps(shuffle_draw_range));
+				const bool source_match = src && src->m_TEX0.TBP0 == bp && src->m_TEX0.TBW == TEX0.TBW && src->m_from_target && src->m_from_target == t;
+
+				// Nothing below applies to targets which aren't under the draw, skip them before the more expensive checks.
+				if (!overlaps && !source_match)
+				{
+					i++;
+					continue;
+				}
+
 				// Some games misuse the scissor so it ends up valid 1 pixel over, which causes hell for us. So check if it still overlaps without the extra pixel.
 				const GSVector4i adjusted_valid = GSVector4i(t->m_valid.x, t->m_valid.y, std::min(t->m_valid.z, static_cast<int>(t->m_TEX0.TBW) * 64), t->m_valid.w - 1);
 				const u32 adjusted_endblock = GSLocalMemory::GetEndBlockAddress(t->m_TEX0.TBP0, t->m_TEX0.TBW, t->m_TEX0.PSM, adjusted_valid);
@@ -2397,11 +2524,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(GIFRegTEX0 TEX0, const GSVe
 				const bool width_match = (t->m_TEX0.TBW == TEX0.TBW || (TEX0.TBW == 1 && draw_rect.w <= GSLocalMemory::m_psm[t->m_TEX0.PSM].pgs.y));
 				const bool ds_offset = !ds || offset != 0;
 				const bool is_double_buffer = TEX0.TBP0 == ((((t->m_end_block + 1) - t->m_TEX0.TBP0) / 2) + t->m_TEX0.TBP0);
-				const bool source_match = src && src->m_TEX0.TBP0 == bp && src->m_TEX0.TBW == TEX0.TBW && src->m_from_target && src->m_from_target == t;
 				const bool was_used_last_draw = t->m_last_draw == (GSState::s_n - 1);
-				// if it's a shuffle, some games tend to offset back by a page, such as Tomb Raider, for no disernable reason, but it then causes problems.
-				// This can also happen horizontally (Catwoman moves everything one page left with shuffles), but this is too messy to deal with right now.
-				const bool overlaps = t->Overlaps(bp, TEX0.TBW, TEX0.PSM, min_rect) || (is_shuffle && src && GSLocalMemory::m_psm[src->m_TEX0.PSM].bpp == 8 && t->Overlaps(bp, TEX0.TBW, TEX0.PSM, min_rect + GSVector4i(0, 0, 0, 32)));
 				if (source_match || (no_target_or_newer && is_aligned_ok && width_match && overlaps && (is_shuffle || ds_offset || is_double_buffer || was_used_last_draw)))
 				{
 					const GSLocalMemory::psm_t& s_psm = GSLocalMemory::m_psm[TEX0.PSM];
@@ -4267,6 +4390,8 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 	const u32 bw = off.bw();
 	const u32 psm = off.psm();
 
+	m_src.InvalidatePageHashes(off, rect);
+
 	// Get the bounds that we're invalidating in blocks, so we can remove any targets which are completely contained.
 	// Unfortunately sometimes the draw rect is incorrect, and since the end block gets the rect -1, it'll underflow,
 	// so we need to prevent that from happening. Just make it a single block in that case, and hope for the best.
@@ -4388,6 +4513,8 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 	RGBAMask rgba;
 	rgba._u32 = GSUtil::GetChannelMask(psm);
 
+	const BlockRange invalidate_range = BlockRange::FromRect(bp, bw, psm, r);
+
 	for (int type = 0; type < 2; type++)
 	{
 		auto& list = m_dst[type];
@@ -4440,7 +4567,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 					}
 				}
 
-				if (t->Overlaps(bp, bw, psm, r))
+				if (t->Overlaps(invalidate_range))
 				{
 					// Try the hard way for partial invalidation.
 					DirtyRectByPage(bp, psm, bw, t, r);
@@ -4457,7 +4584,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 			}
 			// This is a situation where it is uploading in to the alpha channel but that is not part of the mask for the target format.
 			// So we need to make sure the alpha is not marked as valid. (Juiced does a shuffle on the Z24 depth, making the alpha valid data).
-			else if (GSUtil::GetChannelMask(psm) == 0x8 && GSUtil::GetChannelMask(t->m_TEX0.PSM) == 0x7 && t->Overlaps(bp, bw, psm, r))
+			else if (GSUtil::GetChannelMask(psm) == 0x8 && GSUtil::GetChannelMask(t->m_TEX0.PSM) == 0x7 && t->Overlaps(invalidate_range))
 			{
 				t->m_valid_alpha_high &= !(psm == PSMT8H || psm == PSMT4HH);
 				t->m_valid_alpha_low &= !(psm == PSMT8H || psm == PSMT4HL);
@@ -4620,6 +4747,7 @@ void GSTextureCache::InvalidateLocalMem(const GSOffset& off, const GSVector4i& r
 	// SOCOM 2
 	// Fatal Frame series
 	auto& rts = m_dst[RenderTarget];
+	const BlockRange read_range = BlockRange::FromRect(bp, bw, psm, r);
 
 	for (int pass = 0; pass < 2; pass++)
 	{
@@ -4646,7 +4774,7 @@ void GSTextureCache::InvalidateLocalMem(const GSOffset& off, const GSVector4i& r
 			else
 			{
 				// Check loose matches if we still haven't got all the data.
-				const bool expecting_this_tex = t->Overlaps(bp, bw, psm, r);
+				const bool expecting_this_tex = t->Overlaps(read_range);
 
 				if (!expecting_this_tex || !GSUtil::HasSharedBits(psm, t->m_TEX0.PSM))
 					continue;
@@ -6529,7 +6657,8 @@ GSTextureCache::HashCacheEntry* GSTextureCache::LookupHashCache(const GIFRegTEX0
 
 	// need the hash either for replacing, dumping or caching.
 	// if dumping/replacing is on, we compute the clut hash regardless, since replacements aren't indexed
-	HashCacheKey key{HashCacheKey::Create(TEX0, TEXA, (dump || replace || !paltex) ? clut : nullptr, lod, region)};
+	// replacement names use the serial hash, so only take the faster paths when the key stays in memory
+	HashCacheKey key{HashCacheKey::Create(TEX0, TEXA, (dump || replace || !paltex) ? clut : nullptr, lod, region, !dump && !replace)};
 
 	// handle dumping first, this is mostly isolated.
 	if (dump)
@@ -6955,9 +7084,15 @@ void GSTextureCache::Read(Target* t, const GSVector4i& r)
 			break;
 	}
 
+	m_src.InvalidatePageHashes(off, r);
 	dltex->get()->Unmap();
 }
 
+void GSTextureCache::InvalidatePageHashes(const GSOffset& off, const GSVector4i& r)
+{
+	m_src.InvalidatePageHashes(off, r);
+}
+
 void GSTextureCache::Read(Source* t, const GSVector4i& r)
 {
 	if (r.rempty())
@@ -6976,6 +7111,7 @@ void GSTextureCache::Read(Source* t, const GSVector4i& r)
 		const GSOffset off = g_gs_renderer->m_mem.GetOffset(t->m_TEX0.TBP0, t->m_TEX0.TBW, t->m_TEX0.PSM);
 		g_gs_renderer->m_mem.WritePixel32(
 			const_cast<u8*>(m_color_download_texture->GetMapPointer()), m_color_download_texture->GetMapPitch(), off, r);
+		m_src.InvalidatePageHashes(off, r);
 		m_color_download_texture->Unmap();
 	}
 }
@@ -6996,6 +7132,11 @@ bool GSTextureCache::Surface::Inside(u32 bp, u32 bw, u32 psm, const GSVector4i&
 }
 
 bool GSTextureCache::Surface::Overlaps(u32 bp, u32 bw, u32 psm, const GSVector4i& rect)
+{
+	return Overlaps(BlockRange::FromRect(bp, bw, psm, rect));
+}
+
+GSTextureCache::BlockRange GSTextureCache::BlockRange::FromRect(u32 bp, u32 bw, u32 psm, const GSVector4i& rect)
 {
 	const GSOffset off(GSLocalMemory::m_psm[psm].info, bp, bw, psm);
 
@@ -7017,12 +7158,7 @@ bool GSTextureCache::Surface::Overlaps(u32 bp, u32 bw, u32 psm, const GSVector4i
 		std::swap(start_block, end_block);
 	}
 
-	// Wrapping around to the beginning of memory.
-	if (end_block > MAX_BLOCKS && bp < m_end_block && m_end_block < m_TEX0.TBP0)
-		bp += MAX_BLOCKS;
-
-	const bool overlap = GSTextureCache::CheckOverlap(m_TEX0.TBP0, UnwrappedEndBlock(), start_block, end_block);
-	return overlap;
+	return {start_block, end_block};
 }
 
 // GSTextureCache::Source
@@ -7840,6 +7976,16 @@ void GSTextureCache::SourceMap::RemoveAll()
 	{
 		item.clear();
 	}
+
+	m_page_hash_valid.reset();
+}
+
+void GSTextureCache::SourceMap::InvalidatePageHashes(const GSOffset& off, const GSVector4i& rect)
+{
+	if (m_page_hash_valid.none())
+		return;
+
+	off.loopPages(rect, [this](u32 page) { m_page_hash_valid.reset(page); });
 }
 
 void GSTextureCache::SourceMap::RemoveAt(Source* s)
@@ -8506,7 +8652,123 @@ __fi static GSTextureCache::HashType FinishBlockHash(BlockHashState& st)
 	return GSXXH3_64bits_digest(&st);
 }
 
-static void HashTextureLevel(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, GSTextureCache::SourceRegion region, BlockHashState& hash_st, u8* temp)
+/// Textures with at least this many blocks (512KB) are hashed in parallel. Below that, waking the workers
+/// costs about as much as hashing the whole texture on the GS thread.
+static constexpr u32 PARALLEL_HASH_MIN_BLOCKS = 2048;
+
+/// Returns true if hashing this many blocks is worth splitting, creating the worker pool on first use.
+static bool GetParallelHashPool(u32 blocks)
+{
+	if (blocks < PARALLEL_HASH_MIN_BLOCKS)
+		return false;
+
+	if (!s_hash_pool)
+	{
+		// Leave the other cores to the EE/VU threads, and don't bother on dual-cores.
+		const u32 num_workers = std::min(cpuinfo_get_processors_count() / 2, 3u);
+		if (num_workers == 0)
+			return false;
+
+		DevCon.WriteLn("TC: Creating %u texture hash workers.", num_workers);
+		s_hash_pool = std::make_unique<TextureHashPool>(num_workers);
+	}
+
+	return true;
+}
+
+/// Hashes each page row of blocks separately, then feeds the partial hashes in order into hash_st.
+/// The split only depends on the texture, never on the worker count, so the result is deterministic.
+static void HashTextureBlocksParallel(const GSOffset& off, const GSVector4i& block_rect, const GSLocalMemory::psm_t& psm,
+	BlockHashState& hash_st)
+{
+	GSLocalMemory& mem = g_gs_renderer->m_mem;
+	const int right = block_rect.right >> off.blockShiftX();
+	const int top = block_rect.top >> off.blockShiftY();
+	const int bottom = block_rect.bottom >> off.blockShiftY();
+	const int rows_per_stripe = psm.pgs.y / psm.bs.y;
+	const u32 num_stripes = static_cast<u32>((bottom - top + rows_per_stripe - 1) / rows_per_stripe);
+
+	std::vector<GSTextureCache::HashType> partials(num_stripes);
+	s_hash_pool->Run(num_stripes, [&](u32 stripe) {
+		BlockHashState st;
+		BlockHashReset(st);
+
+		const int stripe_top = top + static_cast<int>(stripe) * rows_per_stripe;
+		const int stripe_bottom = std::min(stripe_top + rows_per_stripe, bottom);
+		GSOffset::BNHelper bn = off.bnMulti(block_rect.left, stripe_top << off.blockShiftY());
+		for (; bn.blkY() < stripe_bottom; bn.nextBlockY())
+		{
+			for (; bn.blkX() < right; bn.nextBlockX())
+				BlockHashAccumulate(st, mem.BlockPtr(bn.value()));
+		}
+
+		partials[stripe] = FinishBlockHash(st);
+	});
+
+	BlockHashAccumulate(hash_st, reinterpret_cast<const u8*>(partials.data()),
+		static_cast<u32>(partials.size() * sizeof(GSTextureCache::HashType)));
+}
+
+/// Returns true if the texture is made of whole pages which don't hold anything else.
+static bool CanHashTexturePages(const GIFRegTEX0& TEX0, const GSVector4i& block_rect, const GSLocalMemory::psm_t& psm)
+{
+	const GSVector2i& pgs = psm.pgs;
+	return ((TEX0.TBP0 & (BLOCKS_PER_PAGE - 1)) == 0 && TEX0.TBW != 0 && ((TEX0.TBW * 64) & (pgs.x - 1)) == 0 &&
+			((block_rect.left | block_rect.right) & (pgs.x - 1)) == 0 &&
+			((block_rect.top | block_rect.bottom) & (pgs.y - 1)) == 0);
+}
+
+/// Hashes the texture as the sequence of its page hashes, so only the pages written since they were last
+/// hashed have to be read again.
+static void HashTexturePages(const GSOffset& off, const GSVector4i& block_rect, const GSLocalMemory::psm_t& psm,
+	GSTextureCache::SourceMap& src, BlockHashState& hash_st)
+{
+	const u8* vm = g_gs_renderer->m_mem.vm8();
+	const GSVector2i& pgs = psm.pgs;
+	const u32 num_pages = static_cast<u32>((block_rect.width() / pgs.x) * (block_rect.height() / pgs.y));
+
+	std::vector<u32> pages;
+	std::vector<u32> dirty;
+	std::bitset<MAX_PAGES> queued;
+	pages.reserve(num_pages);
+	for (int y = block_rect.top; y < block_rect.bottom; y += pgs.y)
+	{
+		for (int x = block_rect.left; x < block_rect.right; x += pgs.x)
+		{
+			const u32 page = off.bn(x, y) / BLOCKS_PER_PAGE;
+			pages.push_back(page);
+			if (!src.m_page_hash_valid.test(page) && !queued.test(page))
+			{
+				queued.set(page);
+				dirty.push_back(page);
+			}
+		}
+	}
+
+	const auto hash_page = [&src, &dirty, vm](u32 i) {
+		src.m_page_hash[dirty[i]] = GSXXH3_64bits(vm + dirty[i] * PAGE_SIZE, PAGE_SIZE);
+	};
+	if (GetParallelHashPool(static_cast<u32>(dirty.size()) * BLOCKS_PER_PAGE))
+	{
+		s_hash_pool->Run(static_cast<u32>(dirty.size()), hash_page);
+	}
+	else
+	{
+		for (u32 i = 0; i < static_cast<u32>(dirty.size()); i++)
+			hash_page(i);
+	}
+
+	for (const u32 page : dirty)
+		src.m_page_hash_valid.set(page);
+
+	for (const u32 page : pages)
+		BlockHashAccumulate(hash_st, reinterpret_cast<const u8*>(&src.m_page_hash[page]), sizeof(GSTextureCache::HashType));
+}
+
+/// If src is set, the hash may come from the memoized page hashes or be split across the hash workers, and
+/// won't match the serial hash.
+static void HashTextureLevel(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, GSTextureCache::SourceRegion region, BlockHashState& hash_st,
+	u8* temp, GSTextureCache::SourceMap* src)
 {
 	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
 	const GSVector2i& bs = psm.bs;
@@ -8551,6 +8813,14 @@ static void HashTextureLevel(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, GST
 				BlockHashAccumulate(hash_st, ptr, row_size);
 		}
 	}
+	else if (src && CanHashTexturePages(TEX0, block_rect, psm))
+	{
+		HashTexturePages(off, block_rect, psm, *src, hash_st);
+	}
+	else if (src && GetParallelHashPool(static_cast<u32>(block_rect.width() / bs.x) * static_cast<u32>(block_rect.height() / bs.y)))
+	{
+		HashTextureBlocksParallel(off, block_rect, psm, hash_st);
+	}
 	else
 	{
 		GSOffset::BNHelper bn = off.bnMulti(block_rect.left, block_rect.top);
@@ -8572,7 +8842,7 @@ GSTextureCache::HashType GSTextureCache::HashTexture(const GIFRegTEX0& TEX0, con
 {
 	BlockHashState hash_st;
 	BlockHashReset(hash_st);
-	HashTextureLevel(TEX0, TEXA, region, hash_st, s_unswizzle_buffer);
+	HashTextureLevel(TEX0, TEXA, region, hash_st, s_unswizzle_buffer, &g_texture_cache->m_src);
 	return FinishBlockHash(hash_st);
 }
 
@@ -8637,7 +8907,7 @@ GSTextureCache::HashCacheKey::HashCacheKey()
 	TEXA.U64 = 0;
 }
 
-GSTextureCache::HashCacheKey GSTextureCache::HashCacheKey::Create(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const u32* clut, const GSVector2i* lod, SourceRegion region)
+GSTextureCache::HashCacheKey GSTextureCache::HashCacheKey::Create(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const u32* clut, const GSVector2i* lod, SourceRegion region, bool fast_hash)
 {
 	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
 
@@ -8650,9 +8920,10 @@ GSTextureCache::HashCacheKey GSTextureCache::HashCacheKey::Create(const GIFRegTE
 
 	BlockHashState hash_st;
 	BlockHashReset(hash_st);
+	SourceMap* const src = fast_hash ? &g_texture_cache->m_src : nullptr;
 
 	// base level is always hashed
-	HashTextureLevel(TEX0, TEXA, region, hash_st, s_unswizzle_buffer);
+	HashTextureLevel(TEX0, TEXA, region, hash_st, s_unswizzle_buffer, src);
 
 	if (lod)
 	{
@@ -8662,7 +8933,7 @@ GSTextureCache::HashCacheKey GSTextureCache::HashCacheKey::Create(const GIFRegTE
 		for (int i = 1; i < nmips; i++)
 		{
 			const GIFRegTEX0 MIP_TEX0{g_gs_renderer->GetTex0Layer(basemip + i)};
-			HashTextureLevel(MIP_TEX0, TEXA, region.AdjustForMipmap(i), hash_st, s_unswizzle_buffer);
+			HashTextureLevel(MIP_TEX0, TEXA, region.AdjustForMipmap(i), hash_st, s_unswizzle_buffer, src);
 		}
 	}
 
@@ -7,6 +7,7 @@
 #include "GS/Renderers/Common/GSFastList.h"
 #include "GS/Renderers/Common/GSDirtyRect.h"
 
+#include <bitset>
 #include <unordered_set>
 #include <utility>
 #include <limits>
@@ -37,6 +38,16 @@ public:
 		return valid && overlap;
 	}
 
+	/// Block range covered by a rectangle, as tested by Surface::Overlaps(). Lookups which test every target against
+	/// the same area compute this once, instead of per target.
+	struct BlockRange
+	{
+		u32 start;
+		u32 end;
+
+		static BlockRange FromRect(u32 bp, u32 bw, u32 psm, const GSVector4i& rect);
+	};
+
 	struct SourceRegion
 	{
 		u64 bits;
@@ -97,7 +108,10 @@ public:
 
 		HashCacheKey();
 
-		static HashCacheKey Create(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const u32* clut, const GSVector2i* lod, SourceRegion region);
+		/// If fast_hash is set, large textures are hashed from the memoized page hashes or across the hash workers.
+		/// The resulting hash differs from the serial one, so it must not be used for anything persisted (e.g.
+		/// replacement texture names).
+		static HashCacheKey Create(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const u32* clut, const GSVector2i* lod, SourceRegion region, bool fast_hash);
 
 		HashCacheKey WithRemovedCLUTHash() const;
 		void RemoveCLUTHash();
@@ -159,6 +173,7 @@ public:
 
 		bool Inside(u32 bp, u32 bw, u32 psm, const GSVector4i& rect);
 		bool Overlaps(u32 bp, u32 bw, u32 psm, const GSVector4i& rect);
+		bool Overlaps(const BlockRange& range) const { return CheckOverlap(m_TEX0.TBP0, UnwrappedEndBlock(), range.start, range.end); }
 	};
 
 	struct PaletteKey
@@ -362,10 +377,15 @@ public:
 		std::unordered_set<Source*> m_surfaces;
 		std::array<FastList<Source*>, MAX_PAGES> m_map;
 
+		/// Content hash of each page of local memory. Computed on demand, and dropped when the page is written.
+		std::array<HashType, MAX_PAGES> m_page_hash = {};
+		std::bitset<MAX_PAGES> m_page_hash_valid;
+
 		void Add(Source* s, const GIFRegTEX0& TEX0);
 		void SwapTexture(GSTexture* old_tex, GSTexture* new_tex);
 		void RemoveAll();
 		void RemoveAt(Source* s);
+		void InvalidatePageHashes(const GSOffset& off, const GSVector4i& rect);
 	};
 
 	struct TargetHeightElem
@@ -528,6 +548,9 @@ public:
 	void InvalidateVideoMem(const GSOffset& off, const GSVector4i& r, bool target = true);
 	void InvalidateLocalMem(const GSOffset& off, const GSVector4i& r, bool full_flush = false);
 
+	/// Forgets the memoized page hashes for a region of local memory written without InvalidateVideoMem().
+	void InvalidatePageHashes(const GSOffset& off, const GSVector4i& r);
+
 	/// Removes any sources which point to the specified target.
 	void InvalidateSourcesFromTarget(const Target* t);
 
@@ -12,6 +12,7 @@
 
 #include <csetjmp>
 #include <png.h>
+#include <zstd.h>
 
 struct LoaderDefinition
 {
@@ -21,10 +22,12 @@ struct LoaderDefinition
 
 static bool PNGLoader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
 static bool DDSLoader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
+static bool ZstdLoader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
 
 static constexpr LoaderDefinition s_loaders[] = {
 	{"png", PNGLoader},
 	{"dds", DDSLoader},
+	{"zst", ZstdLoader},
 };
 
 
@@ -263,6 +266,66 @@ bool GSTextureReplacements::SavePNGImage(const std::string& filename, u32 width,
 	return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Zstd Handlers
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Header followed by one zstd frame of tightly packed RGBA8 rows, in the same layout as PNG dumps.
+static constexpr u32 ZSTD_IMAGE_MAGIC = 0x535A5854; // TXZS
+static constexpr int ZSTD_IMAGE_COMPRESSION_LEVEL = 1;
+
+struct ZstdImageHeader
+{
+	u32 magic;
+	u32 width;
+	u32 height;
+	u32 reserved;
+};
+static_assert(sizeof(ZstdImageHeader) == 16, "ZstdImageHeader is expected size");
+
+bool ZstdLoader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image)
+{
+	std::optional<std::vector<u8>> file_data = FileSystem::ReadBinaryFile(filename.c_str());
+	if (!file_data.has_value() || file_data->size() < sizeof(ZstdImageHeader))
+		return false;
+
+	ZstdImageHeader header;
+	std::memcpy(&header, file_data->data(), sizeof(header));
+	if (header.magic != ZSTD_IMAGE_MAGIC || header.width == 0 || header.height == 0)
+		return false;
+
+	const u32 pitch = header.width * sizeof(u32);
+	const size_t size = static_cast<size_t>(pitch) * header.height;
+	tex->width = header.width;
+	tex->height = header.height;
+	tex->format = GSTexture::Format::Color;
+	tex->pitch = pitch;
+	tex->data.resize(size);
+
+	const size_t result = ZSTD_decompress(tex->data.data(), size, file_data->data() + sizeof(header),
+		file_data->size() - sizeof(header));
+	return (!ZSTD_isError(result) && result == size);
+}
+
+bool GSTextureReplacements::SaveZstdImage(const std::string& filename, u32 width, u32 height, const u8* buffer, u32 pitch)
+{
+	const u32 row_size = width * sizeof(u32);
+	std::vector<u8> rows(static_cast<size_t>(row_size) * height);
+	for (u32 y = 0; y < height; y++)
+		std::memcpy(rows.data() + y * row_size, buffer + y * pitch, row_size);
+
+	std::vector<u8> file_data(sizeof(ZstdImageHeader) + ZSTD_compressBound(rows.size()));
+	const ZstdImageHeader header = {ZSTD_IMAGE_MAGIC, width, height, 0};
+	std::memcpy(file_data.data(), &header, sizeof(header));
+
+	const size_t result = ZSTD_compress(file_data.data() + sizeof(header), file_data.size() - sizeof(header),
+		rows.data(), rows.size(), ZSTD_IMAGE_COMPRESSION_LEVEL);
+	if (ZSTD_isError(result))
+		return false;
+
+	return FileSystem::WriteBinaryFile(filename.c_str(), file_data.data(), sizeof(header) + result);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // DDS Handler
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -464,13 +527,15 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			dxt10_format = dxt10_header.dxgiFormat;
 		}
 
-		const GSDevice::FeatureSupport features(g_gs_device->Features());
+		// no device when building packs offline, keep everything and let the runtime filter unsupported formats
+		const bool dxt_textures = !g_gs_device || g_gs_device->Features().dxt_textures;
+		const bool bptc_textures = !g_gs_device || g_gs_device->Features().bptc_textures;
 		if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '1') || dxt10_format == 71 /*DXGI_FORMAT_BC1_UNORM*/)
 		{
 			info->format = GSTexture::Format::BC1;
 			info->block_size = 4;
 			info->bytes_per_block = 8;
-			if (!features.dxt_textures)
+			if (!dxt_textures)
 				return false;
 		}
 		else if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '2') || header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '3') || dxt10_format == 74 /*DXGI_FORMAT_BC2_UNORM*/)
@@ -478,7 +543,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			info->format = GSTexture::Format::BC2;
 			info->block_size = 4;
 			info->bytes_per_block = 16;
-			if (!features.dxt_textures)
+			if (!dxt_textures)
 				return false;
 		}
 		else if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '4') || header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '5') || dxt10_format == 77 /*DXGI_FORMAT_BC3_UNORM*/)
@@ -486,7 +551,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			info->format = GSTexture::Format::BC3;
 			info->block_size = 4;
 			info->bytes_per_block = 16;
-			if (!features.dxt_textures)
+			if (!dxt_textures)
 				return false;
 		}
 		else if (dxt10_format == 98 /*DXGI_FORMAT_BC7_UNORM*/)
@@ -494,7 +559,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			info->format = GSTexture::Format::BC7;
 			info->block_size = 4;
 			info->bytes_per_block = 16;
-			if (!features.bptc_textures)
+			if (!bptc_textures)
 				return false;
 		}
 		else
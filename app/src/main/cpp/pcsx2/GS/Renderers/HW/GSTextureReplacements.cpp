@@ -3,32 +3,50 @@
 
 #include "common/AlignedMalloc.h"
 #include "common/Console.h"
+#include "common/Error.h"
 #include "common/HashCombine.h"
 #include "common/FileSystem.h"
+#include "common/HostSys.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
 #include "common/ScopedGuard.h"
 #include "common/TextureDecompress.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
 
 #include "Config.h"
 #include "Host.h"
 #include "IconsFontAwesome5.h"
 #include "GS/GSExtra.h"
 #include "GS/GSLocalMemory.h"
+#include "GS/GSXXH.h"
 #include "GS/Renderers/HW/GSTextureReplacements.h"
 #include "VMManager.h"
 
+#include "cpuinfo.h"
+
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <condition_variable>
 #include <cstring>
 #include <deque>
 #include <functional>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <tuple>
 #include <thread>
 
+#include <zstd.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 // this is a #define instead of a variable to avoid warnings from non-literal format strings
 #define TEXTURE_FILENAME_FORMAT_STRING "%" PRIx64 "-%08x"
 #define TEXTURE_FILENAME_CLUT_FORMAT_STRING "%" PRIx64 "-%" PRIx64 "-%08x"
@@ -38,6 +56,12 @@
 #define TEXTURE_FILENAME_OLD_REGION_CLUT_FORMAT_STRING "%" PRIx64 "-%" PRIx64 "-r%" PRIx64 "-%08x"
 #define TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME "replacements"
 #define TEXTURE_DUMP_SUBDIRECTORY_NAME "dumps"
+#define TEXTURE_PACK_FILENAME "replacements.pack"
+
+// Palette textures which decode to the same image as one dumped earlier aren't dumped again. Instead a line
+// "<skipped name> <dumped name>" is appended to this file in the dump directory, and replacements of the dumped
+// name are used for the skipped one as well. The file is read from both the dump and replacement directories.
+#define TEXTURE_ALIAS_FILENAME "aliases.txt"
 
 namespace
 {
@@ -80,6 +104,72 @@ namespace
 		}
 	};
 	static_assert(sizeof(TextureName) == 32, "ReplacementTextureName is expected size");
+
+	struct CachedReplacementTexture
+	{
+		GSTextureReplacements::ReplacementTexture rtex;
+		u64 last_use;
+	};
+
+	/// Replacement packs hold a header, the texture payloads, then the entry table at entries_offset.
+	/// A payload is the texture's levels back to back, each [u32 width][u32 height][u32 pitch][u32 size][data].
+	/// Colour payloads are a single zstd frame, block-compressed ones are stored as-is so they can be uploaded
+	/// straight from the mapping.
+	static constexpr u32 TEXTURE_PACK_MAGIC = 0x4B505854; // TXPK
+	static constexpr u32 TEXTURE_PACK_VERSION = 1;
+	static constexpr u8 TEXTURE_PACK_ENTRY_ZSTD = 1u << 0;
+	static constexpr int TEXTURE_PACK_COMPRESSION_LEVEL = 12;
+
+	struct TexturePackHeader
+	{
+		u32 magic;
+		u32 version;
+		u32 num_entries;
+		u32 reserved;
+		u64 entries_offset;
+	};
+	static_assert(sizeof(TexturePackHeader) == 24, "TexturePackHeader is expected size");
+
+	struct TexturePackEntry
+	{
+		TextureName name;
+		u64 offset;
+		u32 size;
+		u32 uncompressed_size;
+		u8 format;
+		u8 flags;
+		u8 alpha_min;
+		u8 alpha_max;
+		u32 reserved;
+	};
+	static_assert(sizeof(TexturePackEntry) == 56, "TexturePackEntry is expected size");
+
+	struct AlignedBufferDeleter
+	{
+		void operator()(u8* ptr) const { _aligned_free(ptr); }
+	};
+
+	/// Texture read out of GS memory on the GS thread, waiting to be encoded by a dump thread.
+	struct PendingTextureDump
+	{
+		std::string filename;
+		std::unique_ptr<u8, AlignedBufferDeleter> buffer;
+		size_t buffer_size;
+		TextureName name;
+		u32 width;
+		u32 height;
+		u32 pitch;
+		u32 offset;
+	};
+
+	struct TexturePackLevel
+	{
+		u32 width;
+		u32 height;
+		u32 pitch;
+		u32 size;
+		const u8* data;
+	};
 } // namespace
 
 namespace std
@@ -112,29 +202,71 @@ namespace GSTextureReplacements
 	static void QueueAsyncReplacementTextureLoad(const TextureName& name, const std::string& filename, bool mipmap, bool cache_only);
 	static void PrecacheReplacementTextures();
 	static void ClearReplacementTextures();
+	static void LoadTextureAliases(const std::string& path);
+
+	static bool OpenTexturePack(const std::string& path);
+	static void CloseTexturePack();
+	static bool IsTexturePackFormat(u8 format);
+	static bool ParseTexturePackLevels(const u8* data, size_t size, GSTexture::Format format, u32 max_levels,
+		std::vector<TexturePackLevel>* levels);
+	static std::optional<ReplacementTexture> LoadPackedReplacementTexture(const TextureName& name, bool only_base_image);
+	static GSTexture* CreatePackedReplacementTexture(const TexturePackEntry& entry, bool mipmap);
+	static void WarnCompressedReplacementWithoutMipmaps();
+
+	static u64 GetReplacementTextureMemoryUsage(const ReplacementTexture& rtex);
+	static void InsertCachedReplacementTexture(const TextureName& name, ReplacementTexture rtex);
+	static u64 GetReplacementTextureBudget();
+	static void EvictReplacementTextures();
+	static void UpdatePrecacheProgress();
 
 	static void StartWorkerThread();
 	static void StopWorkerThread();
-	static void QueueWorkerThreadItem(std::function<void()> fn, bool high_priority);
+	static void QueueWorkerThreadItem(std::function<void()> fn, u64 priority);
 	static void WorkerThreadEntryPoint();
 	static void SyncWorkerThread();
 	static void CancelPendingLoadsAndDumps();
 
+	static void StartDumpThreads();
+	static void StopDumpThreads();
+	static void DumpThreadEntryPoint();
+	static void WritePendingDump(const PendingTextureDump& dump);
+	static void AppendTextureAlias(const PendingTextureDump& dump, const std::string& dumped_title);
+
 	static std::string s_current_serial;
 
 	/// Textures that have been dumped, to save stat() calls.
 	static std::unordered_set<TextureName> s_dumped_textures;
 
-	/// Lookup map of texture names to replacements, if they exist.
+	/// Lookup map of texture names to replacements, if they exist. An empty filename means it's in the pack.
 	static std::unordered_map<TextureName, std::string> s_replacement_texture_filenames;
 
+	/// Memory-mapped replacement pack of the current game, and its entries by name.
+	static const u8* s_texture_pack = nullptr;
+	static size_t s_texture_pack_size = 0;
+#ifdef _WIN32
+	static std::vector<u8> s_texture_pack_buffer;
+#endif
+	static std::unordered_map<TextureName, const TexturePackEntry*> s_texture_pack_entries;
+
 	/// Lookup map of texture names without CLUT hash, to know when we need to disable paltex.
 	static std::unordered_set<TextureName> s_replacement_textures_without_clut_hash;
 
 	/// Lookup map of texture names to replacement data which has been cached.
-	static std::unordered_map<TextureName, ReplacementTexture> s_replacement_texture_cache;
+	static std::unordered_map<TextureName, CachedReplacementTexture> s_replacement_texture_cache;
 	static std::mutex s_replacement_texture_cache_mutex;
 
+	/// Bytes of decoded data in the replacement cache, and the counter used to stamp the last use of each entry.
+	static u64 s_replacement_texture_cache_memory_usage = 0;
+	static u64 s_replacement_texture_use_counter = 0;
+
+	/// Decoded replacements and hash cache textures are kept under this many bytes combined, by dropping the
+	/// least recently used replacements. The hash cache can't be evicted from here, so it only ever takes up
+	/// half of it. Precaching stops loading once the replacements' share is reached.
+	static u64 s_replacement_memory_budget = 0;
+
+	/// Hash cache usage at the last vsync, so the loader threads can check the budget without touching the TC.
+	static std::atomic<u64> s_hash_cache_memory_usage{0};
+
 	/// List of textures that are pending asynchronous load. Second element is whether we're only precaching.
 	static std::unordered_map<TextureName, bool> s_pending_async_load_textures;
 
@@ -142,12 +274,39 @@ namespace GSTextureReplacements
 	/// Second element is whether the texture should be created with mipmaps.
 	static std::vector<std::pair<TextureName, bool>> s_async_loaded_textures;
 
-	/// Loader/dumper thread.
-	static std::thread s_worker_thread;
+	/// Precache progress, reported on the OSD from the GS thread.
+	static std::atomic<u32> s_precache_total{0};
+	static std::atomic<u32> s_precache_completed{0};
+	static u32 s_precache_reported = 0;
+	static Common::Timer s_precache_timer;
+
+	/// Priority of precaching. Requested loads use the last-use counter, so the most recent go first.
+	static constexpr u64 LOW_WORK_PRIORITY = 0;
+
+	/// Loader threads. Items are taken in order of priority, then in the order they were queued.
+	static std::vector<std::thread> s_worker_threads;
 	static std::mutex s_worker_thread_mutex;
 	static std::condition_variable s_worker_thread_cv;
-	static std::deque<std::pair<std::function<void()>, bool>> s_worker_thread_queue;
+	static std::condition_variable s_worker_thread_idle_cv;
+	static std::multimap<u64, std::function<void()>, std::greater<u64>> s_worker_thread_queue;
+	static u32 s_worker_threads_busy = 0;
 	static bool s_worker_thread_running = false;
+
+	/// Dumps are encoded on their own threads, so they never hold up replacement loads. Once this many bytes are
+	/// waiting, new dumps are dropped and retried the next time the texture is seen, instead of stalling the GS thread.
+	static constexpr size_t MAX_QUEUED_DUMP_BYTES = 64 * _1mb;
+
+	static std::vector<std::thread> s_dump_threads;
+	static std::mutex s_dump_mutex;
+	static std::condition_variable s_dump_cv;
+	static std::deque<PendingTextureDump> s_dump_queue;
+	static size_t s_dump_queue_bytes = 0;
+	static u32 s_dumps_dropped = 0;
+	static bool s_dump_threads_running = false;
+
+	/// File titles of dumped palette textures by the hash of their texels, so a texture which decodes to the same
+	/// image under a different CLUT is only written once and aliased to the first one.
+	static std::unordered_map<u64, std::string> s_dumped_content_names;
 }; // namespace GSTextureReplacements
 
 TextureName GSTextureReplacements::CreateTextureName(const GSTextureCache::HashCacheKey& hash, u32 miplevel)
@@ -284,24 +443,25 @@ std::string GSTextureReplacements::GetDumpFilename(const TextureName& name, u32
 		}
 	}
 
+	const char* extension = GSConfig.DumpTexturesZstd ? "zst" : "png";
 	std::string filename;
 	if (name.HasRegion())
 	{
 		if (name.HasPalette())
 		{
 			filename = (level > 0)
-				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_CLUT_FORMAT_STRING "-mip%u.png",
-					name.TEX0Hash, name.CLUTHash, name.region_width, name.region_height, name.bits, level)
-				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_CLUT_FORMAT_STRING ".png",
-					name.TEX0Hash, name.CLUTHash, name.region_width, name.region_height, name.bits);
+				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_CLUT_FORMAT_STRING "-mip%u.%s",
+					name.TEX0Hash, name.CLUTHash, name.region_width, name.region_height, name.bits, level, extension)
+				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_CLUT_FORMAT_STRING ".%s",
+					name.TEX0Hash, name.CLUTHash, name.region_width, name.region_height, name.bits, extension);
 		}
 		else
 		{
 			filename = (level > 0)
-				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_FORMAT_STRING "-mip%u.png",
-					name.TEX0Hash, name.region_width, name.region_height, name.bits, level)
-				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_FORMAT_STRING ".png",
-					name.TEX0Hash, name.region_width, name.region_height, name.bits);
+				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_FORMAT_STRING "-mip%u.%s",
+					name.TEX0Hash, name.region_width, name.region_height, name.bits, level, extension)
+				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_REGION_FORMAT_STRING ".%s",
+					name.TEX0Hash, name.region_width, name.region_height, name.bits, extension);
 		}
 	}
 	else
@@ -309,18 +469,18 @@ std::string GSTextureReplacements::GetDumpFilename(const TextureName& name, u32
 		if (name.HasPalette())
 		{
 			filename = (level > 0)
-				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_CLUT_FORMAT_STRING "-mip%u.png",
-				                                  name.TEX0Hash, name.CLUTHash, name.bits, level)
-				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_CLUT_FORMAT_STRING ".png",
-				                                  name.TEX0Hash, name.CLUTHash, name.bits);
+				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_CLUT_FORMAT_STRING "-mip%u.%s",
+				                                  name.TEX0Hash, name.CLUTHash, name.bits, level, extension)
+				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_CLUT_FORMAT_STRING ".%s",
+				                                  name.TEX0Hash, name.CLUTHash, name.bits, extension);
 		}
 		else
 		{
 			filename = (level > 0)
-				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_FORMAT_STRING "-mip%u.png",
-				                                  name.TEX0Hash, name.bits, level)
-				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_FORMAT_STRING ".png",
-				                                  name.TEX0Hash, name.bits);
+				? StringUtil::StdStringFromFormat(TEXTURE_FILENAME_FORMAT_STRING "-mip%u.%s",
+				                                  name.TEX0Hash, name.bits, level, extension)
+				: StringUtil::StdStringFromFormat(TEXTURE_FILENAME_FORMAT_STRING ".%s",
+				                                  name.TEX0Hash, name.bits, extension);
 		}
 	}
 
@@ -333,8 +493,14 @@ void GSTextureReplacements::Initialize()
 {
 	s_current_serial = VMManager::GetDiscSerial();
 
+	// Leave most of the memory to the rest of the system, texture packs can be many gigabytes decoded.
+	constexpr u64 max_budget = 2048ULL * _1mb;
+	s_replacement_memory_budget = std::min(GetPhysicalMemory() / 4, max_budget);
+
 	if (GSConfig.DumpReplaceableTextures || GSConfig.LoadTextureReplacements)
 		StartWorkerThread();
+	if (GSConfig.DumpReplaceableTextures)
+		StartDumpThreads();
 
 	ReloadReplacementMap();
 }
@@ -380,9 +546,11 @@ void GSTextureReplacements::ReloadReplacementMap()
 	{
 		s_replacement_texture_filenames.clear();
 		s_replacement_textures_without_clut_hash.clear();
+		CloseTexturePack();
 
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
 		s_replacement_texture_cache.clear();
+		s_replacement_texture_cache_memory_usage = 0;
 		s_pending_async_load_textures.clear();
 		s_async_loaded_textures.clear();
 	}
@@ -413,7 +581,7 @@ void GSTextureReplacements::ReloadReplacementMap()
 	}
 
 	if (!FileSystem::FindFiles(replacement_dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE, &files))
-		return;
+		files.clear();
 
 	std::string filename;
 	for (FILESYSTEM_FIND_DATA& fd : files)
@@ -436,6 +604,44 @@ void GSTextureReplacements::ReloadReplacementMap()
 		s_replacement_textures_without_clut_hash.insert(name.value());
 	}
 
+	// then anything in the pack, loose files take precedence so packs can be patched
+	const std::string pack_path(Path::Combine(texture_dir, TEXTURE_PACK_FILENAME));
+	if (FileSystem::FileExists(pack_path.c_str()) && OpenTexturePack(pack_path))
+	{
+		const GSDevice::FeatureSupport features(g_gs_device->Features());
+		const TexturePackHeader* header = reinterpret_cast<const TexturePackHeader*>(s_texture_pack);
+		const TexturePackEntry* entries = reinterpret_cast<const TexturePackEntry*>(s_texture_pack + header->entries_offset);
+		u32 unsupported = 0;
+		for (u32 i = 0; i < header->num_entries; i++)
+		{
+			const TexturePackEntry& entry = entries[i];
+			const GSTexture::Format format = static_cast<GSTexture::Format>(entry.format);
+			if ((!features.dxt_textures && format >= GSTexture::Format::BC1 && format <= GSTexture::Format::BC3) ||
+				(!features.bptc_textures && format == GSTexture::Format::BC7))
+			{
+				unsupported++;
+				continue;
+			}
+
+			if (!s_replacement_texture_filenames.emplace(entry.name, std::string()).second)
+				continue;
+
+			s_texture_pack_entries.emplace(entry.name, &entry);
+
+			TextureName name = entry.name;
+			name.CLUTHash = 0;
+			s_replacement_textures_without_clut_hash.insert(name);
+		}
+
+		Console.WriteLn("Using %zu replacements from '%s'.", s_texture_pack_entries.size(), pack_path.c_str());
+		if (unsupported > 0)
+			Console.Warning("Skipped %u packed replacements with compressed formats the GPU does not support.", unsupported);
+	}
+
+	// palette variants which weren't dumped because another one decodes to the same image
+	LoadTextureAliases(Path::Combine(replacement_dir, TEXTURE_ALIAS_FILENAME));
+	LoadTextureAliases(Path::Combine(Path::Combine(texture_dir, TEXTURE_DUMP_SUBDIRECTORY_NAME), TEXTURE_ALIAS_FILENAME));
+
 	if (!s_replacement_texture_filenames.empty())
 	{
 		if (GSConfig.PrecacheTextureReplacements)
@@ -450,6 +656,42 @@ void GSTextureReplacements::ReloadReplacementMap()
 	}
 }
 
+void GSTextureReplacements::LoadTextureAliases(const std::string& path)
+{
+	const std::optional<std::string> aliases = FileSystem::ReadFileToString(path.c_str());
+	if (!aliases.has_value())
+		return;
+
+	u32 count = 0;
+	for (const std::string_view line : StringUtil::SplitString(aliases.value(), '\n'))
+	{
+		const std::vector<std::string_view> titles = StringUtil::SplitString(StringUtil::StripWhitespace(line), ' ');
+		if (titles.size() != 2)
+			continue;
+
+		const std::optional<TextureName> alias = ParseReplacementName(fmt::format("{}.", titles[0]));
+		const std::optional<TextureName> target = ParseReplacementName(fmt::format("{}.", titles[1]));
+		if (!alias.has_value() || !target.has_value())
+			continue;
+
+		// loose files and pack entries of the alias itself take precedence
+		const auto it = s_replacement_texture_filenames.find(target.value());
+		if (it == s_replacement_texture_filenames.end() || !s_replacement_texture_filenames.emplace(alias.value(), it->second).second)
+			continue;
+
+		if (it->second.empty())
+			s_texture_pack_entries.emplace(alias.value(), s_texture_pack_entries.find(target.value())->second);
+
+		TextureName name = alias.value();
+		name.CLUTHash = 0;
+		s_replacement_textures_without_clut_hash.insert(name);
+		count++;
+	}
+
+	if (count > 0)
+		Console.WriteLn("Using %u palette aliases from '%s'.", count, path.c_str());
+}
+
 void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 {
 	// get rid of worker thread if it's no longer needed
@@ -457,6 +699,10 @@ void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 		StopWorkerThread();
 	if (!s_worker_thread_running && (GSConfig.DumpReplaceableTextures || GSConfig.LoadTextureReplacements))
 		StartWorkerThread();
+	if (GSConfig.DumpReplaceableTextures && !old_config.DumpReplaceableTextures)
+		StartDumpThreads();
+	else if (!GSConfig.DumpReplaceableTextures && old_config.DumpReplaceableTextures)
+		StopDumpThreads();
 
 	if ((!GSConfig.DumpReplaceableTextures && old_config.DumpReplaceableTextures) ||
 		(!GSConfig.LoadTextureReplacements && old_config.LoadTextureReplacements))
@@ -478,6 +724,7 @@ void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 
 void GSTextureReplacements::Shutdown()
 {
+	StopDumpThreads();
 	StopWorkerThread();
 
 	std::string().swap(s_current_serial);
@@ -519,8 +766,20 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 		if (it != s_replacement_texture_cache.end())
 		{
 			// replacement is cached, can immediately upload to host GPU
-			*alpha_minmax = it->second.alpha_minmax;
-			return CreateReplacementTexture(it->second, mipmap);
+			it->second.last_use = ++s_replacement_texture_use_counter;
+			*alpha_minmax = it->second.rtex.alpha_minmax;
+			return CreateReplacementTexture(it->second.rtex, mipmap);
+		}
+	}
+
+	// block-compressed pack entries don't need decoding, so upload them straight from the mapping
+	if (fnit->second.empty())
+	{
+		const TexturePackEntry& entry = *s_texture_pack_entries.find(name)->second;
+		if (!(entry.flags & TEXTURE_PACK_ENTRY_ZSTD))
+		{
+			*alpha_minmax = std::make_pair(entry.alpha_min, entry.alpha_max);
+			return CreatePackedReplacementTexture(entry, mipmap);
 		}
 	}
 
@@ -543,7 +802,8 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 
 		// insert into cache
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
-		const ReplacementTexture& rtex = s_replacement_texture_cache.emplace(name, std::move(replacement.value())).first->second;
+		InsertCachedReplacementTexture(name, std::move(replacement.value()));
+		const ReplacementTexture& rtex = s_replacement_texture_cache.find(name)->second.rtex;
 
 		// and upload to gpu
 		*alpha_minmax = rtex.alpha_minmax;
@@ -630,6 +890,9 @@ void GSTextureReplacements::SetReplacementTextureAlphaMinMax(ReplacementTexture&
 
 std::optional<GSTextureReplacements::ReplacementTexture> GSTextureReplacements::LoadReplacementTexture(const TextureName& name, const std::string& filename, bool only_base_image)
 {
+	if (filename.empty())
+		return LoadPackedReplacementTexture(name, only_base_image);
+
 	ReplacementTextureLoader loader = GetLoader(filename);
 	if (!loader)
 		return std::nullopt;
@@ -652,7 +915,7 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 	auto it = s_pending_async_load_textures.find(name);
 	if (it != s_pending_async_load_textures.end())
 	{
-		// remove from queue if it's cache-only, so we bump it to the front of the work items
+		// requeue if it's cache-only, so we bump it to the front of the work items
 		if (!cache_only && it->second)
 		{
 			s_pending_async_load_textures.erase(it);
@@ -665,7 +928,29 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 	}
 
 	s_pending_async_load_textures.emplace(name, cache_only);
-	QueueWorkerThreadItem([name, filename, mipmap]() {
+	const u64 priority = cache_only ? LOW_WORK_PRIORITY : ++s_replacement_texture_use_counter;
+	QueueWorkerThreadItem([name, filename, mipmap, cache_only]() {
+		ScopedGuard precache_progress([cache_only]() {
+			if (cache_only)
+				s_precache_completed.fetch_add(1, std::memory_order_relaxed);
+		});
+
+		// skip the load if another thread already got to it, e.g. after being bumped from precaching
+		{
+			std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
+			auto it = s_pending_async_load_textures.find(name);
+			if (it == s_pending_async_load_textures.end())
+				return;
+
+			// precaching also stops once the memory budget is used up
+			if (s_replacement_texture_cache.find(name) != s_replacement_texture_cache.end() ||
+				(it->second && s_replacement_texture_cache_memory_usage >= GetReplacementTextureBudget()))
+			{
+				s_pending_async_load_textures.erase(it);
+				return;
+			}
+		}
+
 		// actually load the file, this is what will take the time
 		std::optional<ReplacementTexture> replacement(LoadReplacementTexture(name, filename, !mipmap));
 
@@ -685,7 +970,7 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 		// insert into the cache and queue for later injection
 		if (replacement.has_value())
 		{
-			s_replacement_texture_cache.emplace(name, std::move(replacement.value()));
+			InsertCachedReplacementTexture(name, std::move(replacement.value()));
 			s_async_loaded_textures.emplace_back(name, mipmap);
 		}
 		else
@@ -693,7 +978,101 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 			// loading failed, so clear it from the pending list
 			s_pending_async_load_textures.erase(name);
 		}
-	}, !cache_only);
+	}, priority);
+}
+
+u64 GSTextureReplacements::GetReplacementTextureMemoryUsage(const ReplacementTexture& rtex)
+{
+	u64 size = rtex.data.size();
+	for (const ReplacementTexture::MipData& mip : rtex.mips)
+		size += mip.data.size();
+	return size;
+}
+
+void GSTextureReplacements::InsertCachedReplacementTexture(const TextureName& name, ReplacementTexture rtex)
+{
+	// caller holds the cache lock
+	const u64 size = GetReplacementTextureMemoryUsage(rtex);
+	if (s_replacement_texture_cache.emplace(name, CachedReplacementTexture{std::move(rtex), ++s_replacement_texture_use_counter}).second)
+		s_replacement_texture_cache_memory_usage += size;
+}
+
+u64 GSTextureReplacements::GetReplacementTextureBudget()
+{
+	const u64 hash_cache_usage = s_hash_cache_memory_usage.load(std::memory_order_relaxed);
+	return s_replacement_memory_budget - std::min(hash_cache_usage, s_replacement_memory_budget / 2);
+}
+
+void GSTextureReplacements::EvictReplacementTextures()
+{
+	// caller holds the cache lock
+	const u64 budget = GetReplacementTextureBudget();
+	if (s_replacement_texture_cache_memory_usage <= budget)
+		return;
+
+	// textures waiting to be injected have to stay around
+	std::vector<std::pair<u64, TextureName>> candidates;
+	candidates.reserve(s_replacement_texture_cache.size());
+	for (const auto& [name, entry] : s_replacement_texture_cache)
+	{
+		if (s_pending_async_load_textures.find(name) == s_pending_async_load_textures.end())
+			candidates.emplace_back(entry.last_use, name);
+	}
+	std::sort(candidates.begin(), candidates.end(),
+		[](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+	const u64 old_usage = s_replacement_texture_cache_memory_usage;
+	u32 evicted = 0;
+	for (const auto& [last_use, name] : candidates)
+	{
+		if (s_replacement_texture_cache_memory_usage <= budget)
+			break;
+
+		auto it = s_replacement_texture_cache.find(name);
+		s_replacement_texture_cache_memory_usage -= GetReplacementTextureMemoryUsage(it->second.rtex);
+		s_replacement_texture_cache.erase(it);
+		evicted++;
+	}
+
+	if (evicted > 0)
+	{
+		DevCon.WriteLn("Evicted %u replacement textures (%" PRIu64 " MB -> %" PRIu64 " MB, budget %" PRIu64 " MB).", evicted,
+			old_usage / _1mb, s_replacement_texture_cache_memory_usage / _1mb, budget / _1mb);
+	}
+}
+
+void GSTextureReplacements::UpdatePrecacheProgress()
+{
+	const u32 total = s_precache_total.load(std::memory_order_relaxed);
+	const u32 completed = s_precache_completed.load(std::memory_order_relaxed);
+	if (total == 0 || completed == s_precache_reported)
+		return;
+
+	s_precache_reported = completed;
+	if (completed < total)
+	{
+		Host::AddIconOSDMessage("ReplacementPrecache", ICON_FA_IMAGES,
+			fmt::format(TRANSLATE_FS("TextureReplacement", "Precaching replacement textures: {} / {}"), completed, total),
+			Host::OSD_INFO_DURATION);
+		return;
+	}
+
+	u64 cached_memory;
+	{
+		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
+		cached_memory = s_replacement_texture_cache_memory_usage;
+	}
+
+	const double elapsed = s_precache_timer.GetTimeSeconds();
+	Console.WriteLn("Precached %u replacement textures in %.2f seconds, %" PRIu64 " MB in memory.", total, elapsed,
+		cached_memory / _1mb);
+	Host::AddIconOSDMessage("ReplacementPrecache", ICON_FA_IMAGES,
+		fmt::format(TRANSLATE_FS("TextureReplacement", "Precached {} replacement textures in {:.1f} seconds."), total, elapsed),
+		Host::OSD_INFO_DURATION);
+
+	s_precache_total.store(0, std::memory_order_relaxed);
+	s_precache_completed.store(0, std::memory_order_relaxed);
+	s_precache_reported = 0;
 }
 
 void GSTextureReplacements::PrecacheReplacementTextures()
@@ -705,23 +1084,45 @@ void GSTextureReplacements::PrecacheReplacementTextures()
 	const bool mipmap = GSConfig.HWMipmap || GSConfig.TriFilter == TriFiltering::Forced;
 
 	// pretty simple, just go through the filenames and if any aren't cached, cache them
+	u32 queued = 0;
 	for (const auto& it : s_replacement_texture_filenames)
 	{
-		if (s_replacement_texture_cache.find(it.first) != s_replacement_texture_cache.end())
+		if (s_replacement_texture_cache.find(it.first) != s_replacement_texture_cache.end() ||
+			s_pending_async_load_textures.find(it.first) != s_pending_async_load_textures.end())
+		{
+			continue;
+		}
+
+		// uncompressed pack entries are uploaded from the mapping, there's nothing to precache
+		if (it.second.empty() && !(s_texture_pack_entries.find(it.first)->second->flags & TEXTURE_PACK_ENTRY_ZSTD))
 			continue;
 
 		// precaching always goes async.. for now
 		QueueAsyncReplacementTextureLoad(it.first, it.second, mipmap, true);
+		queued++;
 	}
+
+	if (queued == 0)
+		return;
+
+	Console.WriteLn("Precaching %u replacement textures on %zu threads.", queued, s_worker_threads.size());
+	if (s_precache_total.load(std::memory_order_relaxed) == 0)
+		s_precache_timer.Reset();
+	s_precache_total.fetch_add(queued, std::memory_order_relaxed);
 }
 
 void GSTextureReplacements::ClearReplacementTextures()
 {
+	// loads may still be reading from the pack
+	SyncWorkerThread();
+
 	s_replacement_texture_filenames.clear();
 	s_replacement_textures_without_clut_hash.clear();
+	CloseTexturePack();
 
 	std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
 	s_replacement_texture_cache.clear();
+	s_replacement_texture_cache_memory_usage = 0;
 	s_pending_async_load_textures.clear();
 	s_async_loaded_textures.clear();
 }
@@ -732,17 +1133,7 @@ GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementText
 	// in the future I guess we could decompress the dds and generate them... but there's no reason that modders can't generate mips in dds
 	if (mipmap && GSTexture::IsCompressedFormat(rtex.format) && rtex.mips.empty())
 	{
-		static bool log_once = false;
-		if (!log_once)
-		{
-			Console.Warning("Disabling autogenerated mipmaps on one or more compressed replacement textures.");
-			Host::AddIconOSDMessage("DisablingReplacementAutoGeneratedMipmap", ICON_FA_EXCLAMATION_CIRCLE,
-				TRANSLATE_SV("GS", "Disabling autogenerated mipmaps on one or more compressed replacement textures. "
-								   "Please generate mipmaps when compressing your textures."),
-				Host::OSD_WARNING_DURATION);
-			log_once = true;
-		}
-
+		WarnCompressedReplacementWithoutMipmaps();
 		mipmap = false;
 	}
 
@@ -766,8 +1157,25 @@ GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementText
 	return tex;
 }
 
+void GSTextureReplacements::WarnCompressedReplacementWithoutMipmaps()
+{
+	static bool log_once = false;
+	if (log_once)
+		return;
+
+	Console.Warning("Disabling autogenerated mipmaps on one or more compressed replacement textures.");
+	Host::AddIconOSDMessage("DisablingReplacementAutoGeneratedMipmap", ICON_FA_EXCLAMATION_CIRCLE,
+		TRANSLATE_SV("GS", "Disabling autogenerated mipmaps on one or more compressed replacement textures. "
+						   "Please generate mipmaps when compressing your textures."),
+		Host::OSD_WARNING_DURATION);
+	log_once = true;
+}
+
 void GSTextureReplacements::ProcessAsyncLoadedTextures()
 {
+	UpdatePrecacheProgress();
+	s_hash_cache_memory_usage.store(g_texture_cache->GetTotalHashCacheMemoryUsage(), std::memory_order_relaxed);
+
 	// this holds the lock while doing the upload, but it should be reasonably quick
 	std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
 	for (const auto& [name, mipmap] : s_async_loaded_textures)
@@ -790,11 +1198,13 @@ void GSTextureReplacements::ProcessAsyncLoadedTextures()
 			continue;
 
 		// upload and inject into TC
-		GSTexture* tex = CreateReplacementTexture(it->second, mipmap);
+		GSTexture* tex = CreateReplacementTexture(it->second.rtex, mipmap);
 		if (tex)
-			g_texture_cache->InjectHashCacheTexture(HashCacheKeyFromTextureName(name), tex, it->second.alpha_minmax);
+			g_texture_cache->InjectHashCacheTexture(HashCacheKeyFromTextureName(name), tex, it->second.rtex.alpha_minmax);
 	}
 	s_async_loaded_textures.clear();
+
+	EvictReplacementTextures();
 }
 
 void GSTextureReplacements::DumpTexture(const GSTextureCache::HashCacheKey& hash, const GIFRegTEX0& TEX0,
@@ -805,16 +1215,10 @@ void GSTextureReplacements::DumpTexture(const GSTextureCache::HashCacheKey& hash
 	if (s_dumped_textures.find(name) != s_dumped_textures.end() || s_replacement_texture_filenames.find(name) != s_replacement_texture_filenames.end())
 		return;
 
-	s_dumped_textures.insert(name);
-
-	// already exists on disk?
 	std::string filename(GetDumpFilename(name, level));
-	if (filename.empty() || FileSystem::FileExists(filename.c_str()))
+	if (filename.empty() || s_dump_threads.empty())
 		return;
 
-	const std::string_view title(Path::GetFileTitle(filename));
-	DevCon.WriteLn("Dumping %ux%u texture '%.*s'.", name.Width(), name.Height(), static_cast<int>(title.size()), title.data());
-
 	// compute width/height
 	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
 	const GSVector2i& bs = psm.bs;
@@ -826,97 +1230,424 @@ void GSTextureReplacements::DumpTexture(const GSTextureCache::HashCacheKey& hash
 	const int read_height = block_rect.height();
 	const u32 pitch = static_cast<u32>(read_width) * sizeof(u32);
 
+	const size_t buffer_size = static_cast<size_t>(pitch) * static_cast<u32>(read_height);
+	{
+		std::unique_lock<std::mutex> lock(s_dump_mutex);
+		if ((s_dump_queue_bytes + buffer_size) > MAX_QUEUED_DUMP_BYTES)
+		{
+			// not marked as dumped, so we'll try again next time the texture is looked up
+			s_dumps_dropped++;
+			return;
+		}
+
+		s_dump_queue_bytes += buffer_size;
+	}
+
+	s_dumped_textures.insert(name);
+
 	// use per-texture buffer so we can compress the texture asynchronously and not block the GS thread
 	// must be 32 byte aligned for ReadTexture().
-	u8* buffer = static_cast<u8*>(_aligned_malloc(pitch * static_cast<u32>(read_height), 32));
-	psm.rtx(mem, mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM), block_rect, buffer, pitch, TEXA);
-
-	// okay, now we can actually dump it
-	const u32 buffer_offset = ((rect.top - block_rect.top) * pitch) + ((rect.left - block_rect.left) * sizeof(u32));
-	QueueWorkerThreadItem([filename = std::move(filename), tw, th, pitch, buffer, buffer_offset]() {
-		if (!SavePNGImage(filename.c_str(), tw, th, buffer + buffer_offset, pitch))
-			Console.Error(fmt::format("Failed to dump texture to '{}'.", filename));
-		_aligned_free(buffer);
-	}, false);
+	PendingTextureDump dump;
+	dump.filename = std::move(filename);
+	dump.buffer.reset(static_cast<u8*>(_aligned_malloc(buffer_size, 32)));
+	dump.buffer_size = buffer_size;
+	dump.name = name;
+	dump.width = static_cast<u32>(tw);
+	dump.height = static_cast<u32>(th);
+	dump.pitch = pitch;
+	dump.offset = ((rect.top - block_rect.top) * pitch) + ((rect.left - block_rect.left) * sizeof(u32));
+	psm.rtx(mem, mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM), block_rect, dump.buffer.get(), pitch, TEXA);
+
+	std::unique_lock<std::mutex> lock(s_dump_mutex);
+	s_dump_queue.push_back(std::move(dump));
+	s_dump_cv.notify_one();
 }
 
 void GSTextureReplacements::ClearDumpedTextureList()
 {
 	s_dumped_textures.clear();
+
+	std::unique_lock<std::mutex> lock(s_dump_mutex);
+	s_dumped_content_names.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Worker Thread
+// Replacement Packs
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void GSTextureReplacements::StartWorkerThread()
+bool GSTextureReplacements::OpenTexturePack(const std::string& path)
 {
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+	Error error;
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(path.c_str(), "rb", &error);
+	if (!fp)
+	{
+		Console.Error("Failed to open replacement pack '%s': %s", path.c_str(), error.GetDescription().c_str());
+		return false;
+	}
+
+	const s64 size = FileSystem::FSize64(fp.get());
+	if (size < static_cast<s64>(sizeof(TexturePackHeader)))
+	{
+		Console.Error("Replacement pack '%s' is truncated.", path.c_str());
+		return false;
+	}
+
+#ifdef _WIN32
+	s_texture_pack_buffer.resize(static_cast<size_t>(size));
+	if (std::fread(s_texture_pack_buffer.data(), static_cast<size_t>(size), 1, fp.get()) != 1)
+	{
+		Console.Error("Failed to read replacement pack '%s'.", path.c_str());
+		s_texture_pack_buffer = {};
+		return false;
+	}
+	s_texture_pack = s_texture_pack_buffer.data();
+#else
+	void* ptr = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, fileno(fp.get()), 0);
+	if (ptr == MAP_FAILED)
+	{
+		Console.Error("Failed to map replacement pack '%s': errno %d", path.c_str(), errno);
+		return false;
+	}
+	s_texture_pack = static_cast<const u8*>(ptr);
+#endif
+	s_texture_pack_size = static_cast<size_t>(size);
+
+	// check the table fits, and every payload is in front of it
+	const TexturePackHeader* header = reinterpret_cast<const TexturePackHeader*>(s_texture_pack);
+	bool valid = (header->magic == TEXTURE_PACK_MAGIC && header->version == TEXTURE_PACK_VERSION &&
+				  (header->entries_offset % alignof(TexturePackEntry)) == 0 && header->entries_offset <= s_texture_pack_size &&
+				  header->num_entries <= (s_texture_pack_size - header->entries_offset) / sizeof(TexturePackEntry));
+	if (valid)
+	{
+		const TexturePackEntry* entries = reinterpret_cast<const TexturePackEntry*>(s_texture_pack + header->entries_offset);
+		for (u32 i = 0; i < header->num_entries && valid; i++)
+		{
+			valid = (entries[i].offset >= sizeof(TexturePackHeader) && entries[i].offset <= header->entries_offset &&
+					 entries[i].size <= header->entries_offset - entries[i].offset &&
+					 IsTexturePackFormat(entries[i].format));
+		}
+	}
+
+	if (!valid)
+	{
+		Console.Error("Replacement pack '%s' is invalid or from a different version.", path.c_str());
+		CloseTexturePack();
+		return false;
+	}
+
+	return true;
+}
 
-	if (s_worker_thread.joinable())
+void GSTextureReplacements::CloseTexturePack()
+{
+	s_texture_pack_entries.clear();
+	if (!s_texture_pack)
 		return;
 
-	s_worker_thread_running = true;
-	s_worker_thread = std::thread(WorkerThreadEntryPoint);
+#ifdef _WIN32
+	s_texture_pack_buffer = {};
+#else
+	munmap(const_cast<u8*>(s_texture_pack), s_texture_pack_size);
+#endif
+	s_texture_pack = nullptr;
+	s_texture_pack_size = 0;
 }
 
-void GSTextureReplacements::StopWorkerThread()
+bool GSTextureReplacements::IsTexturePackFormat(u8 format)
 {
+	// Replacements are only ever loaded as RGBA8 or block compressed.
+	return (format == static_cast<u8>(GSTexture::Format::Color) ||
+			GSTexture::IsCompressedFormat(static_cast<GSTexture::Format>(format)));
+}
+
+bool GSTextureReplacements::ParseTexturePackLevels(const u8* data, size_t size, GSTexture::Format format, u32 max_levels,
+	std::vector<TexturePackLevel>* levels)
+{
+	size_t pos = 0;
+	while (pos < size && levels->size() < max_levels)
 	{
-		std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-		if (!s_worker_thread.joinable())
-			return;
+		u32 level_header[4];
+		if ((size - pos) < sizeof(level_header))
+			return false;
+
+		std::memcpy(level_header, data + pos, sizeof(level_header));
+		pos += sizeof(level_header);
+		if ((size - pos) < level_header[3] || level_header[0] == 0 || level_header[1] == 0)
+			return false;
+
+		// The level is uploaded as pitch * rows of blocks, which has to be inside the payload.
+		const u64 block_size = GSTexture::GetCompressedBlockSize(format);
+		const u64 min_pitch = ((level_header[0] + block_size - 1) / block_size) * GSTexture::GetCompressedBytesPerBlock(format);
+		const u64 upload_size = static_cast<u64>(level_header[2]) * ((level_header[1] + block_size - 1) / block_size);
+		if (level_header[2] < min_pitch || upload_size > level_header[3])
+			return false;
+
+		levels->push_back(TexturePackLevel{level_header[0], level_header[1], level_header[2], level_header[3], data + pos});
+		pos += level_header[3];
+	}
 
-		s_worker_thread_running = false;
-		s_worker_thread_cv.notify_one();
+	return !levels->empty();
+}
+
+std::optional<GSTextureReplacements::ReplacementTexture> GSTextureReplacements::LoadPackedReplacementTexture(const TextureName& name, bool only_base_image)
+{
+	const auto it = s_texture_pack_entries.find(name);
+	if (it == s_texture_pack_entries.end())
+		return std::nullopt;
+
+	const TexturePackEntry& entry = *it->second;
+	const u8* payload = s_texture_pack + entry.offset;
+	size_t payload_size = entry.size;
+
+	std::vector<u8> decompressed;
+	if (entry.flags & TEXTURE_PACK_ENTRY_ZSTD)
+	{
+		decompressed.resize(entry.uncompressed_size);
+		const size_t result = ZSTD_decompress(decompressed.data(), decompressed.size(), payload, payload_size);
+		if (ZSTD_isError(result) || result != decompressed.size())
+		{
+			Console.Warning("Failed to decompress packed replacement %" PRIx64 ": %s", name.TEX0Hash,
+				ZSTD_isError(result) ? ZSTD_getErrorName(result) : "size mismatch");
+			return std::nullopt;
+		}
+
+		payload = decompressed.data();
+		payload_size = decompressed.size();
 	}
 
-	s_worker_thread.join();
+	std::vector<TexturePackLevel> levels;
+	if (!ParseTexturePackLevels(payload, payload_size, static_cast<GSTexture::Format>(entry.format),
+			only_base_image ? 1 : std::numeric_limits<u32>::max(), &levels))
+	{
+		Console.Warning("Packed replacement %" PRIx64 " is corrupted.", name.TEX0Hash);
+		return std::nullopt;
+	}
 
-	// clear out workery-things too
-	CancelPendingLoadsAndDumps();
+	ReplacementTexture rtex;
+	rtex.width = levels[0].width;
+	rtex.height = levels[0].height;
+	rtex.format = static_cast<GSTexture::Format>(entry.format);
+	rtex.alpha_minmax = std::make_pair(entry.alpha_min, entry.alpha_max);
+	rtex.pitch = levels[0].pitch;
+
+	rtex.data.assign(levels[0].data, levels[0].data + levels[0].size);
+	for (size_t i = 1; i < levels.size(); i++)
+	{
+		ReplacementTexture::MipData& mip = rtex.mips.emplace_back();
+		mip.width = levels[i].width;
+		mip.height = levels[i].height;
+		mip.pitch = levels[i].pitch;
+		mip.data.assign(levels[i].data, levels[i].data + levels[i].size);
+	}
+
+	return rtex;
 }
 
-void GSTextureReplacements::QueueWorkerThreadItem(std::function<void()> fn, bool high_priority)
+GSTexture* GSTextureReplacements::CreatePackedReplacementTexture(const TexturePackEntry& entry, bool mipmap)
 {
-	pxAssert(s_worker_thread.joinable());
+	const GSTexture::Format format = static_cast<GSTexture::Format>(entry.format);
+	std::vector<TexturePackLevel> levels;
+	if (!ParseTexturePackLevels(s_texture_pack + entry.offset, entry.size, format, mipmap ? std::numeric_limits<u32>::max() : 1, &levels))
+	{
+		Console.Warning("Packed replacement %" PRIx64 " is corrupted.", entry.name.TEX0Hash);
+		return nullptr;
+	}
 
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	if (!high_priority)
+	if (mipmap && levels.size() == 1)
+		WarnCompressedReplacementWithoutMipmaps();
+
+	GSTexture* tex = g_gs_device->CreateTexture(levels[0].width, levels[0].height, static_cast<int>(levels.size()), format);
+	if (!tex)
+		return nullptr;
+
+	for (u32 i = 0; i < static_cast<u32>(levels.size()); i++)
 	{
-		// Low priority => throw on end.
-		s_worker_thread_queue.emplace_back(std::move(fn), false);
+		const TexturePackLevel& level = levels[i];
+		tex->Update(GSVector4i(0, 0, static_cast<int>(level.width), static_cast<int>(level.height)), level.data, level.pitch, i);
 	}
-	else
+
+	return tex;
+}
+
+bool GSTextureReplacements::BuildReplacementPack(const std::string& texture_dir, Error* error)
+{
+	const std::string replacement_dir(Path::Combine(texture_dir, TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME));
+	FileSystem::FindResultsArray files;
+	if (!FileSystem::FindFiles(replacement_dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE, &files) ||
+		files.empty())
 	{
-		auto iter = s_worker_thread_queue.rbegin();
-		for (; iter != s_worker_thread_queue.rend(); ++iter)
+		Error::SetString(error, fmt::format("No replacement textures found in '{}'.", replacement_dir));
+		return false;
+	}
+
+	const std::string pack_path(Path::Combine(texture_dir, TEXTURE_PACK_FILENAME));
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(pack_path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	ZSTD_CCtx* cctx = ZSTD_createCCtx();
+	const ScopedGuard cctx_guard([cctx]() { ZSTD_freeCCtx(cctx); });
+
+	TexturePackHeader header = {};
+	if (std::fwrite(&header, sizeof(header), 1, fp.get()) != 1)
+	{
+		Error::SetErrno(error, "fwrite() failed: ", errno);
+		return false;
+	}
+
+	Common::Timer timer;
+	std::vector<TexturePackEntry> entries;
+	std::unordered_set<TextureName> packed_names;
+	std::vector<u8> payload;
+	std::vector<u8> compressed;
+	u64 offset = sizeof(header);
+	u64 input_size = 0;
+
+	const auto append_level = [&payload](u32 width, u32 height, u32 pitch, const std::vector<u8>& data) {
+		const u32 level_header[4] = {width, height, pitch, static_cast<u32>(data.size())};
+		payload.insert(payload.end(), reinterpret_cast<const u8*>(level_header), reinterpret_cast<const u8*>(level_header) + sizeof(level_header));
+		payload.insert(payload.end(), data.begin(), data.end());
+	};
+
+	for (const FILESYSTEM_FIND_DATA& fd : files)
+	{
+		const std::string filename(Path::GetFileName(fd.FileName));
+		const ReplacementTextureLoader loader = GetLoader(filename);
+		const std::optional<TextureName> name = loader ? ParseReplacementName(filename) : std::nullopt;
+		if (!name.has_value())
+			continue;
+
+		if (!packed_names.insert(name.value()).second)
 		{
-			// Found our first high priority item?
-			if (iter->second)
-			{
-				// Insert after here!
-				break;
-			}
+			Console.Warning("Skipping '%s', another file has the same name.", fd.FileName.c_str());
+			continue;
 		}
 
-		if (iter != s_worker_thread_queue.rend())
+		ReplacementTexture rtex;
+		if (!loader(fd.FileName, &rtex, false))
 		{
-			// Insert after the last high priority item. Remember base() points to the next element.
-			s_worker_thread_queue.insert(iter.base(), std::make_pair(std::move(fn), true));
+			Console.Warning("Failed to load replacement texture %s", fd.FileName.c_str());
+			continue;
 		}
-		else
+		SetReplacementTextureAlphaMinMax(rtex);
+		input_size += static_cast<u64>(fd.Size);
+
+		payload.clear();
+		append_level(rtex.width, rtex.height, rtex.pitch, rtex.data);
+		for (const ReplacementTexture::MipData& mip : rtex.mips)
+			append_level(mip.width, mip.height, mip.pitch, mip.data);
+
+		TexturePackEntry& entry = entries.emplace_back();
+		entry = {};
+		entry.name = name.value();
+		entry.offset = offset;
+		entry.uncompressed_size = static_cast<u32>(payload.size());
+		entry.format = static_cast<u8>(rtex.format);
+		entry.alpha_min = rtex.alpha_minmax.first;
+		entry.alpha_max = rtex.alpha_minmax.second;
+
+		const u8* data = payload.data();
+		size_t size = payload.size();
+		if (!GSTexture::IsCompressedFormat(rtex.format))
+		{
+			compressed.resize(ZSTD_compressBound(payload.size()));
+			const size_t result = ZSTD_compressCCtx(cctx, compressed.data(), compressed.size(), payload.data(), payload.size(),
+				TEXTURE_PACK_COMPRESSION_LEVEL);
+			if (ZSTD_isError(result))
+			{
+				Error::SetString(error, fmt::format("Failed to compress '{}': {}", fd.FileName, ZSTD_getErrorName(result)));
+				return false;
+			}
+
+			entry.flags |= TEXTURE_PACK_ENTRY_ZSTD;
+			data = compressed.data();
+			size = result;
+		}
+
+		entry.size = static_cast<u32>(size);
+		if (std::fwrite(data, size, 1, fp.get()) != 1)
 		{
-			// All low-priority => insert at beginning.
-			s_worker_thread_queue.emplace_front(std::move(fn), true);
+			Error::SetErrno(error, "fwrite() failed: ", errno);
+			return false;
 		}
+		offset += size;
+
+		if ((entries.size() % 100) == 0)
+			Console.WriteLn("Packed %zu replacement textures...", entries.size());
+	}
+
+	// entry table goes at the end, aligned so it can be used in place from the mapping
+	static constexpr u8 padding[alignof(TexturePackEntry)] = {};
+	const u64 padding_size = Common::AlignUpPow2(offset, alignof(TexturePackEntry)) - offset;
+	header.magic = TEXTURE_PACK_MAGIC;
+	header.version = TEXTURE_PACK_VERSION;
+	header.num_entries = static_cast<u32>(entries.size());
+	header.entries_offset = offset + padding_size;
+	if ((padding_size > 0 && std::fwrite(padding, padding_size, 1, fp.get()) != 1) ||
+		(!entries.empty() && std::fwrite(entries.data(), sizeof(TexturePackEntry), entries.size(), fp.get()) != entries.size()) ||
+		FileSystem::FSeek64(fp.get(), 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, fp.get()) != 1 ||
+		std::fflush(fp.get()) != 0)
+	{
+		Error::SetErrno(error, "Failed to write pack: ", errno);
+		return false;
+	}
+
+	Console.WriteLn("Packed %zu replacement textures (%" PRIu64 " MB of files) into '%s' (%" PRIu64 " MB) in %.2f seconds.",
+		entries.size(), input_size / _1mb, pack_path.c_str(), (header.entries_offset + entries.size() * sizeof(TexturePackEntry)) / _1mb,
+		timer.GetTimeSeconds());
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Worker Thread
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GSTextureReplacements::StartWorkerThread()
+{
+	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+
+	if (!s_worker_threads.empty())
+		return;
+
+	// decoding is mostly PNG inflate, which scales well, but leave cores for the EE/GS threads
+	const u32 num_threads = std::clamp<u32>(cpuinfo_get_processors_count() / 2, 1, 4);
+	s_worker_thread_running = true;
+	for (u32 i = 0; i < num_threads; i++)
+		s_worker_threads.emplace_back(WorkerThreadEntryPoint);
+}
+
+void GSTextureReplacements::StopWorkerThread()
+{
+	{
+		std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+		if (s_worker_threads.empty())
+			return;
+
+		s_worker_thread_running = false;
+		s_worker_thread_cv.notify_all();
 	}
 
+	for (std::thread& thread : s_worker_threads)
+		thread.join();
+	s_worker_threads.clear();
+
+	// clear out workery-things too
+	CancelPendingLoadsAndDumps();
+}
+
+void GSTextureReplacements::QueueWorkerThreadItem(std::function<void()> fn, u64 priority)
+{
+	pxAssert(!s_worker_threads.empty());
+
+	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+	s_worker_thread_queue.emplace(priority, std::move(fn));
 	s_worker_thread_cv.notify_one();
 }
 
 void GSTextureReplacements::WorkerThreadEntryPoint()
 {
+	Threading::SetNameOfCurrentThread("GS Texture Loader");
+
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
 	while (s_worker_thread_running)
 	{
@@ -926,37 +1657,151 @@ void GSTextureReplacements::WorkerThreadEntryPoint()
 			continue;
 		}
 
-		std::function<void()> fn = std::move(s_worker_thread_queue.front().first);
-		s_worker_thread_queue.pop_front();
+		auto it = s_worker_thread_queue.begin();
+		std::function<void()> fn = std::move(it->second);
+		s_worker_thread_queue.erase(it);
+		s_worker_threads_busy++;
 		lock.unlock();
 		fn();
 		lock.lock();
+
+		if (--s_worker_threads_busy == 0 && s_worker_thread_queue.empty())
+			s_worker_thread_idle_cv.notify_all();
 	}
 }
 
 void GSTextureReplacements::SyncWorkerThread()
 {
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	if (!s_worker_thread.joinable())
+	if (s_worker_threads.empty())
+		return;
+
+	s_worker_thread_idle_cv.wait(lock, []() { return s_worker_thread_queue.empty() && s_worker_threads_busy == 0; });
+}
+
+void GSTextureReplacements::CancelPendingLoadsAndDumps()
+{
+	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+	s_worker_thread_queue.clear();
+	s_async_loaded_textures.clear();
+	s_pending_async_load_textures.clear();
+	s_precache_total.store(0, std::memory_order_relaxed);
+	s_precache_completed.store(0, std::memory_order_relaxed);
+	s_precache_reported = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Dump Threads
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GSTextureReplacements::StartDumpThreads()
+{
+	std::unique_lock<std::mutex> lock(s_dump_mutex);
+
+	if (!s_dump_threads.empty())
 		return;
 
-	// not the most efficient by far, but it only gets called on config changes, so whatever
+	// deflate is the bottleneck, but the loaders and the GS need the cores more
+	const u32 num_threads = std::clamp<u32>(cpuinfo_get_processors_count() / 4, 1, 3);
+	s_dump_threads_running = true;
+	for (u32 i = 0; i < num_threads; i++)
+		s_dump_threads.emplace_back(DumpThreadEntryPoint);
+}
+
+void GSTextureReplacements::StopDumpThreads()
+{
+	{
+		std::unique_lock<std::mutex> lock(s_dump_mutex);
+		if (s_dump_threads.empty())
+			return;
+
+		// anything already read out is still written, it'd be wasted otherwise
+		s_dump_threads_running = false;
+		s_dump_cv.notify_all();
+	}
+
+	for (std::thread& thread : s_dump_threads)
+		thread.join();
+	s_dump_threads.clear();
+
+	if (s_dumps_dropped > 0)
+	{
+		Console.Warning("%u texture dumps were skipped because the dump queue was full.", s_dumps_dropped);
+		s_dumps_dropped = 0;
+	}
+}
+
+void GSTextureReplacements::DumpThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("GS Texture Dumper");
+
+	std::unique_lock<std::mutex> lock(s_dump_mutex);
 	for (;;)
 	{
-		if (s_worker_thread_queue.empty())
-			break;
+		if (s_dump_queue.empty())
+		{
+			if (!s_dump_threads_running)
+				break;
 
+			s_dump_cv.wait(lock);
+			continue;
+		}
+
+		PendingTextureDump dump = std::move(s_dump_queue.front());
+		s_dump_queue.pop_front();
 		lock.unlock();
-		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		WritePendingDump(dump);
 		lock.lock();
+
+		s_dump_queue_bytes -= dump.buffer_size;
 	}
 }
 
-void GSTextureReplacements::CancelPendingLoadsAndDumps()
+void GSTextureReplacements::WritePendingDump(const PendingTextureDump& dump)
 {
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	while (!s_worker_thread_queue.empty())
-		s_worker_thread_queue.pop_back();
-	s_async_loaded_textures.clear();
-	s_pending_async_load_textures.clear();
+	// already exists on disk?
+	if (FileSystem::FileExists(dump.filename.c_str()))
+		return;
+
+	const u8* data = dump.buffer.get() + dump.offset;
+	if (dump.name.HasPalette())
+	{
+		// seeding with the texture hash keeps unrelated textures which happen to decode the same apart
+		XXH3_state_t st;
+		XXH3_64bits_reset_withSeed(&st, dump.name.TEX0Hash);
+		const u32 dims[3] = {dump.width, dump.height, dump.name.miplevel};
+		XXH3_64bits_update(&st, dims, sizeof(dims));
+		for (u32 y = 0; y < dump.height; y++)
+			GSXXH3_64bits_update(&st, data + y * dump.pitch, dump.width * sizeof(u32));
+
+		const u64 content_hash = XXH3_64bits_digest(&st);
+		std::unique_lock<std::mutex> lock(s_dump_mutex);
+		const auto [it, inserted] = s_dumped_content_names.try_emplace(content_hash, Path::GetFileTitle(dump.filename));
+		if (!inserted)
+		{
+			// mipmaps are found through the name of the base level, so only that one needs an alias
+			if (dump.name.miplevel == 0)
+				AppendTextureAlias(dump, it->second);
+			return;
+		}
+	}
+
+	const std::string_view title(Path::GetFileTitle(dump.filename));
+	DevCon.WriteLn("Dumping %ux%u texture '%.*s'.", dump.width, dump.height, static_cast<int>(title.size()), title.data());
+
+	const bool result = (Path::GetExtension(dump.filename) == "zst") ?
+							SaveZstdImage(dump.filename, dump.width, dump.height, data, dump.pitch) :
+							SavePNGImage(dump.filename, dump.width, dump.height, data, dump.pitch);
+	if (!result)
+		Console.Error(fmt::format("Failed to dump texture to '{}'.", dump.filename));
+}
+
+void GSTextureReplacements::AppendTextureAlias(const PendingTextureDump& dump, const std::string& dumped_title)
+{
+	// caller holds the dump lock, which keeps the lines from interleaving
+	const std::string path(Path::Combine(Path::GetDirectory(dump.filename), TEXTURE_ALIAS_FILENAME));
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(path.c_str(), "ab");
+	const std::string_view title(Path::GetFileTitle(dump.filename));
+	if (!fp || std::fprintf(fp.get(), "%.*s %s\n", static_cast<int>(title.size()), title.data(), dumped_title.c_str()) < 0)
+		Console.Error(fmt::format("Failed to write texture alias to '{}'.", path));
 }
@@ -7,6 +7,8 @@
 
 #include <utility>
 
+class Error;
+
 namespace GSTextureReplacements
 {
 	struct ReplacementTexture
@@ -53,4 +55,12 @@ namespace GSTextureReplacements
 
 	/// Saves an image buffer to a PNG file (for dumping).
 	bool SavePNGImage(const std::string& filename, u32 width, u32 height, const u8* buffer, u32 pitch);
+
+	/// Saves an image buffer as zstd-compressed RGBA (for dumping). Several times faster to write than PNG,
+	/// and loadable as a replacement, but most image tools can't open it.
+	bool SaveZstdImage(const std::string& filename, u32 width, u32 height, const u8* buffer, u32 pitch);
+
+	/// Packs everything in the replacements directory of texture_dir into a single replacements.pack next to it.
+	/// Packs are memory-mapped when the game starts, and loose files still take precedence over packed ones.
+	bool BuildReplacementPack(const std::string& texture_dir, Error* error);
 } // namespace GSTextureReplacements
@@ -123,8 +123,47 @@ int GSRasterizer::GetPixels(bool reset)
 	return pixels;
 }
 
+void GSRasterizer::ConvertVertices(GSRasterizerData& data)
+{
+	auto& cv = data.convert;
+
+	for (;;)
+	{
+		const u32 chunk = cv.next.fetch_add(1, std::memory_order_relaxed);
+		if (chunk >= cv.chunks)
+			break;
+
+		const u32 first = chunk * cv.CHUNK_SIZE;
+		const u32 count = std::min<u32>(cv.CHUNK_SIZE, data.vertex_count - first);
+		GSVertexSW* RESTRICT v = data.vertex + first;
+
+		cv.func(cv.ctx, v, cv.src + first, count);
+
+		if (cv.half_pel)
+		{
+			// See GSRendererSW::GetScanlineGlobalData(), has to happen after conversion.
+			const GSVector4 half(0x8000, 0x8000);
+
+			for (u32 i = 0; i < count; i++)
+			{
+				GSVector4 t = v[i].t;
+
+				v[i].t = (t - half).xyzw(t);
+			}
+		}
+
+		cv.done.fetch_add(1, std::memory_order_release);
+	}
+
+	while (cv.done.load(std::memory_order_acquire) < cv.chunks)
+		Threading::SpinWait();
+}
+
 void GSRasterizer::Draw(GSRasterizerData& data)
 {
+	if (data.convert.func)
+		ConvertVertices(data);
+
 	if ((data.vertex && data.vertex_count == 0) || (data.index && data.index_count == 0))
 		return;
 
@@ -11,6 +11,8 @@
 #include "GS/GSRingHeap.h"
 #include "GS/MultiISA.h"
 
+#include <atomic>
+
 MULTI_ISA_UNSHARED_START
 
 class GSDrawScanline;
@@ -40,6 +42,22 @@ public:
 	GSDrawScanline::DrawScanlinePtr draw_scanline;
 	GSDrawScanline::DrawScanlinePtr draw_edge;
 
+	/// Vertex conversion handed off to the rasterizer threads (func == nullptr if vertex is already converted).
+	/// Every thread the draw is queued on claims chunks until none are left and then waits for the chunks
+	/// still in flight, so no thread starts rasterizing before the whole buffer is converted.
+	struct
+	{
+		static constexpr u32 CHUNK_SIZE = 1024; // even, sprite conversion looks at vertex pairs
+
+		GSVertexSW::ConvertVertexBufferPtr func;
+		const GSDrawingContext* ctx;
+		const GSVertex* src;
+		bool half_pel;
+		u32 chunks;
+		std::atomic<u32> next;
+		std::atomic<u32> done;
+	} convert = {};
+
 	GSRasterizerData()
 		: scissor(GSVector4i::zero())
 		, bbox(GSVector4i::zero())
@@ -102,6 +120,8 @@ protected:
 
 	void DrawEdge(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& dv, int orientation, int side);
 
+	static void ConvertVertices(GSRasterizerData& data);
+
 	__forceinline void AddScanline(GSVertexSW* e, int pixels, int left, int top, const GSVertexSW& scan);
 	__forceinline void Flush(const GSVertexSW* vertex, const u16* index, const GSVertexSW& dscan, bool edge = false);
 
@@ -6,8 +6,11 @@
 #include "GS/GSPng.h"
 #include "GS/GSUtil.h"
 
+#include "common/HostSys.h"
 #include "common/StringUtil.h"
 
+#include <thread>
+
 MULTI_ISA_UNSHARED_IMPL;
 
 GSRenderer* CURRENT_ISA::makeGSRendererSW(int threads)
@@ -21,8 +24,11 @@ GSRenderer* CURRENT_ISA::makeGSRendererSW(int threads)
 
 static constexpr GSVector4 s_pos_scale = GSVector4::cxpr(1.0f / 16, 1.0f / 16, 1.0f, 128.0f);
 
+// Below this, converting on the GS thread is cheaper than waking the rasterizers up for it.
+static constexpr u32 DEFER_CONVERT_MIN_VERTICES = 4096;
+
 GSRendererSW::GSRendererSW(int threads)
-	: GSRenderer(), m_fzb(NULL)
+	: GSRenderer(), m_threads(threads), m_fzb(NULL)
 {
 	m_nativeres = true; // ignore ini, sw is always native
 
@@ -327,11 +333,19 @@ void GSRendererSW::Draw()
 	auto data = m_vertex_heap.make_shared<SharedData>().cast<GSRasterizerData>();
 	SharedData* sd = static_cast<SharedData*>(data.get());
 
+	// Large draws leave the conversion to the rasterizer threads, which split it between themselves before
+	// rasterizing. We only copy the raw vertices, since m_vertex is reused as soon as we return.
+	const bool defer_convert = m_threads > 0 && m_vertex.next >= DEFER_CONVERT_MIN_VERTICES;
+	const size_t vertex_size = sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1);
+	const size_t index_size = sizeof(u32) * m_index.tail;
+	const size_t raw_offset = (vertex_size + index_size + 31) & ~static_cast<size_t>(31);
+	const size_t raw_size = defer_convert ? sizeof(GSVertex) * m_vertex.next : 0;
+
 	sd->primclass = m_vt.m_primclass;
-	sd->buff = (u8*)m_vertex_heap.alloc(sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(u32) * m_index.tail, 64);
+	sd->buff = (u8*)m_vertex_heap.alloc(defer_convert ? raw_offset + raw_size : vertex_size + index_size, 64);
 	sd->vertex = (GSVertexSW*)sd->buff;
 	sd->vertex_count = m_vertex.next;
-	sd->index = (u16*)(sd->buff + sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1));
+	sd->index = (u16*)(sd->buff + vertex_size);
 	sd->index_count = m_index.tail;
 	sd->scanmsk_value = m_draw_env->SCANMSK.MSK;
 
@@ -340,7 +354,26 @@ void GSRendererSW::Draw()
 	// If you have both GS_SPRITE_CLASS && m_vt.m_eq.q, it will depends on the first part of the 'OR'
 	u32 q_div = !IsMipMapActive() && ((m_vt.m_eq.q && m_vt.m_min.t.z != 1.0f) || (!m_vt.m_eq.q && m_vt.m_primclass == GS_SPRITE_CLASS));
 
-	GSVertexSW::s_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div](m_context, sd->vertex, m_vertex.buff, m_vertex.next);
+	const GSVertexSW::ConvertVertexBufferPtr cvb = GSVertexSW::s_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div];
+
+	if (defer_convert)
+	{
+		GSVertex* raw = (GSVertex*)(sd->buff + raw_offset);
+		std::memcpy(raw, m_vertex.buff, raw_size);
+
+		sd->m_convert_ctx.XYOFFSET = context->XYOFFSET;
+		sd->m_convert_ctx.TEX0 = context->TEX0;
+		sd->m_convert_ctx.ZBUF = context->ZBUF;
+
+		sd->convert.func = cvb;
+		sd->convert.ctx = &sd->m_convert_ctx;
+		sd->convert.src = raw;
+		sd->convert.chunks = (m_vertex.next + sd->convert.CHUNK_SIZE - 1) / sd->convert.CHUNK_SIZE;
+	}
+	else
+	{
+		cvb(m_context, sd->vertex, m_vertex.buff, m_vertex.next);
+	}
 
 	std::memcpy(sd->index, m_index.buff, sizeof(u16) * m_index.tail);
 
@@ -517,7 +550,7 @@ void GSRendererSW::Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item)
 
 	if (sd->m_syncpoint == SharedData::SyncSource)
 	{
-		Sync(4);
+		SyncPages(sd, 4);
 	}
 
 	// update previously invalidated parts
@@ -526,7 +559,7 @@ void GSRendererSW::Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item)
 
 	if (sd->m_syncpoint == SharedData::SyncTarget)
 	{
-		Sync(5);
+		SyncPages(sd, 5);
 	}
 
 	if constexpr (LOG)
@@ -598,6 +631,103 @@ void GSRendererSW::Sync(int reason)
 	g_perfmon.Put(GSPerfMon::Fillrate, pixels);
 }
 
+void GSRendererSW::SyncPages(const SharedData* sd, int reason)
+{
+	if (m_rl->IsSynced())
+		return;
+
+	// sd already holds references on its own pages, those are expected to remain
+
+	u32 own_fzb[MAX_PAGES] = {};
+	u16 own_tex[MAX_PAGES] = {};
+	u32 touched[MAX_PAGES / 32] = {};
+	u16 pages[MAX_PAGES];
+	size_t count = 0;
+
+	const auto touch = [&touched, &pages, &count](u32 page)
+	{
+		if (!(touched[page >> 5] & (1u << (page & 31))))
+		{
+			touched[page >> 5] |= 1u << (page & 31);
+			pages[count++] = static_cast<u16>(page);
+		}
+	};
+
+	if (sd->global.sel.fb)
+	{
+		sd->m_fb_pages.loopPages([&own_fzb, &touch](u32 page)
+		{
+			own_fzb[page] += 1;
+			touch(page);
+		});
+	}
+
+	if (sd->global.sel.zb)
+	{
+		sd->m_zb_pages.loopPages([&own_fzb, &touch](u32 page)
+		{
+			own_fzb[page] += 0x10000;
+			touch(page);
+		});
+	}
+
+	for (size_t i = 0; sd->m_tex[i].t != NULL; i++)
+	{
+		sd->m_tex[i].t->m_pages.loopPages([&own_tex, &touch](u32 page)
+		{
+			own_tex[page] += 1;
+			touch(page);
+		});
+	}
+
+	WaitPages(pages, count, own_fzb, own_tex, reason);
+}
+
+void GSRendererSW::WaitPages(const u16* pages, size_t count, const u32* own_fzb, const u16* own_tex, int reason)
+{
+	// Every queued draw holds a reference on the pages it reads or writes until it retires on the last worker,
+	// so the counters act as per-page fences. Waiting for them instead of draining all queues lets draws
+	// touching unrelated pages keep running, which is what Sync() would have stalled on.
+
+	u64 t = LOG ? GetCPUTicks() : 0;
+
+	const auto busy = [this, pages, count, own_fzb, own_tex]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			const u32 page = pages[i];
+
+			if (m_fzb_pages[page].load(std::memory_order_acquire) != (own_fzb ? own_fzb[page] : 0) ||
+				m_tex_pages[page].load(std::memory_order_acquire) != (own_tex ? own_tex[page] : 0))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	u32 spin_ns = 0;
+
+	while (busy())
+	{
+		if (spin_ns < SPIN_TIME_NS)
+			spin_ns += ShortSpin();
+		else
+			std::this_thread::yield();
+	}
+
+	g_perfmon.Put(GSPerfMon::SyncAvoided, 1);
+
+	if constexpr (LOG)
+	{
+		t = GetCPUTicks() - t;
+
+		fprintf(s_fp, "sync pages n=%d r=%d t=%" PRIu64 " c=%zu\n", s_n, reason, t, count);
+		fflush(s_fp);
+	}
+}
+
 void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r)
 {
 	if constexpr (LOG)
@@ -613,18 +743,20 @@ void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 
 	if (!m_rl->IsSynced())
 	{
-		pages.loopPagesWithBreak([this](u32 page)
+		u16 busy[MAX_PAGES];
+		size_t count = 0;
+
+		pages.loopPages([this, &busy, &count](u32 page)
 		{
 			if (m_fzb_pages[page] | m_tex_pages[page])
-			{
-				Sync(6);
-				return false;
-			}
-			return true;
+				busy[count++] = static_cast<u16>(page);
 		});
+
+		if (count > 0)
+			WaitPages(busy, count, nullptr, nullptr, 6);
 	}
 
-	m_tc->InvalidatePages(pages, off.psm()); // if texture update runs on a thread and Sync(5) happens then this must come later
+	m_tc->InvalidateBlocks(off, r); // if texture update runs on a thread and Sync(5) happens then this must come later
 }
 
 void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut)
@@ -640,15 +772,17 @@ void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 		GSOffset off = m_mem.GetOffset(BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM);
 		GSOffset::PageLooper pages = off.pageLooperForRect(r);
 
-		pages.loopPagesWithBreak([this](u32 page)
+		u16 busy[MAX_PAGES];
+		size_t count = 0;
+
+		pages.loopPages([this, &busy, &count](u32 page)
 		{
 			if (m_fzb_pages[page])
-			{
-				Sync(7);
-				return false;
-			}
-			return true;
+				busy[count++] = static_cast<u16>(page);
 		});
+
+		if (count > 0)
+			WaitPages(busy, count, nullptr, nullptr, 7);
 	}
 }
 
@@ -1165,7 +1299,12 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 				// Note: the 'q' division was done in GSRendererSW::ConvertVertexBuffer
 				gd.sel.fst |= (m_vt.m_eq.q || primclass == GS_SPRITE_CLASS);
 
-				if (gd.sel.ltf && gd.sel.fst)
+				if (gd.sel.ltf && gd.sel.fst && data->convert.func)
+				{
+					// vertices aren't converted yet, the rasterizer threads will apply the shift
+					data->convert.half_pel = true;
+				}
+				else if (gd.sel.ltf && gd.sel.fst)
 				{
 					// if q is constant we can do the half pel shift for bilinear sampling on the vertices
 
@@ -28,6 +28,7 @@ public:
 		int m_zpsm;
 		bool m_using_pages;
 		TextureLevel m_tex[7 + 1]; // NULL terminated
+		GSDrawingContext m_convert_ctx; // registers read by ConvertVertexBuffer when conversion is deferred
 		enum
 		{
 			SyncNone,
@@ -49,6 +50,7 @@ public:
 protected:
 	std::unique_ptr<IRasterizer> m_rl;
 	std::unique_ptr<GSTextureCacheSW> m_tc;
+	int m_threads;
 	GSRingHeap m_vertex_heap;
 	std::array<GSTexture*, 3> m_texture = {};
 	u8* m_output;
@@ -68,6 +70,8 @@ protected:
 	void Draw() override;
 	void Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item);
 	void Sync(int reason);
+	void SyncPages(const SharedData* sd, int reason);
+	void WaitPages(const u16* pages, size_t count, const u32* own_fzb, const u16* own_tex, int reason);
 	void InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r) override;
 	void InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut = false) override;
 
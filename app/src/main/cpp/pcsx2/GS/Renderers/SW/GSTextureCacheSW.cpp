@@ -86,6 +86,62 @@ void GSTextureCacheSW::InvalidatePages(const GSOffset::PageLooper& pages, u32 ps
 	});
 }
 
+void GSTextureCacheSW::InvalidateBlocks(const GSOffset& off, const GSVector4i& rect)
+{
+	// Small uploads (CLUTs, sprite sheet patches) only touch a few blocks of a page, so track
+	// exactly which blocks were written instead of throwing away the whole page.
+	// Repeating textures track tiles rather than blocks and still lose the whole page.
+
+	const u32 psm = off.psm();
+	const GSVector4i r = rect.ralign<Align_Outside>(GSLocalMemory::m_psm[psm].bs);
+
+	u32 dirty[MAX_PAGES] = {};
+
+	GSOffset::BNHelper bn = off.bnMulti(r.left, r.top);
+	const int right = r.right >> off.blockShiftX();
+	const int bottom = r.bottom >> off.blockShiftY();
+
+	for (; bn.blkY() < bottom; bn.nextBlockY())
+	{
+		for (; bn.blkX() < right; bn.nextBlockX())
+		{
+			const u32 block = bn.value();
+			dirty[block >> 5] |= 1u << (block & 31);
+		}
+	}
+
+	off.pageLooperForRect(r).loopPages([this, psm, &dirty](u32 page)
+	{
+		const u32 blocks = dirty[page];
+		if (blocks == 0)
+			return;
+
+		for (Texture* t : m_map[page])
+		{
+			if (GSUtil::HasSharedBits(psm, t->m_sharedbits))
+			{
+				u32* RESTRICT valid = t->m_valid;
+
+				if (t->m_repeating)
+				{
+					for (const GSVector2i& j : t->m_p2t[page])
+					{
+						valid[j.x] &= j.y;
+					}
+
+					t->m_complete = false;
+				}
+				else if (valid[page] & blocks)
+				{
+					valid[page] &= ~blocks;
+
+					t->m_complete = false;
+				}
+			}
+		}
+	});
+}
+
 void GSTextureCacheSW::RemoveAll()
 {
 	for (auto i : m_textures)
@@ -250,6 +306,8 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 
 	int block_pitch = pitch * bs.y;
 
+	const int bytes_per_block = (bs.x * bs.y) << shift;
+
 	shift += off.blockShiftX();
 	int bottom = r.bottom >> off.blockShiftY();
 	int right = r.right >> off.blockShiftX();
@@ -304,7 +362,7 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 
 	if (blocks > 0)
 	{
-		g_perfmon.Put(GSPerfMon::Unswizzle, bs.x * bs.y * blocks << shift);
+		g_perfmon.Put(GSPerfMon::Unswizzle, bytes_per_block * blocks);
 	}
 
 	return true;
@@ -52,6 +52,9 @@ public:
 
 	void InvalidatePages(const GSOffset::PageLooper& pages, u32 psm);
 
+	/// Like InvalidatePages(), but only drops the blocks covered by the rect (rounded out to whole blocks).
+	void InvalidateBlocks(const GSOffset& off, const GSVector4i& r);
+
 	void RemoveAll();
 	void IncAge();
 };
@@ -42,6 +42,7 @@ static u32 s_dump_frame_number = 0;
 static s32 s_dump_loop_count = 0;
 static bool s_dump_running = false;
 static bool s_needs_state_loaded = false;
+static u32 s_seek_target_frame = 0;
 static u64 s_frame_ticks = 0;
 static u64 s_next_frame_time = 0;
 static bool s_is_dump_runner = false;
@@ -182,6 +183,29 @@ u32 GSDumpReplayer::GetFrameNumber()
 	return s_dump_frame_number;
 }
 
+u32 GSDumpReplayer::GetFrameCount()
+{
+	return s_dump_file ? s_dump_file->GetFrameCount() : 0;
+}
+
+bool GSDumpReplayer::SeekToFrame(u32 frame)
+{
+	Error error;
+	const std::optional<u32> keyframe = s_dump_file->SeekToFrame(frame, &error);
+	if (!keyframe.has_value() || !s_dump_file->ReadNextChunk(&error))
+	{
+		Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to seek to frame {}: {}", frame, error.GetDescription()));
+		return false;
+	}
+
+	// Restore the keyframe state, then run the remaining frames unthrottled.
+	s_needs_state_loaded = true;
+	s_current_packet = 0;
+	s_dump_frame_number = keyframe.value();
+	s_seek_target_frame = frame;
+	return true;
+}
+
 void GSDumpReplayerCpuReserve()
 {
 }
@@ -195,6 +219,15 @@ void GSDumpReplayerCpuReset()
 	s_needs_state_loaded = true;
 	s_current_packet = 0;
 	s_dump_frame_number = 0;
+	s_seek_target_frame = 0;
+
+	// Streamed dumps only hold the current chunk, so go back to the start.
+	if (s_dump_file && s_dump_file->IsStreaming())
+	{
+		Error error;
+		if (!s_dump_file->SeekToFrame(0, &error).has_value() || !s_dump_file->ReadNextChunk(&error))
+			Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to rewind dump: {}", error.GetDescription()));
+	}
 }
 
 static void GSDumpReplayerLoadInitialState()
@@ -253,6 +286,48 @@ static void GSDumpReplayerFrameLimit()
 	s_next_frame_time = std::max(now, s_next_frame_time + s_frame_ticks);
 }
 
+/// Returns false if the replay should stop.
+static bool GSDumpReplayerEndOfDump()
+{
+	s_dump_frame_number = 0;
+	if (s_dump_loop_count > 0)
+	{
+		s_dump_loop_count--;
+	}
+	else if (s_dump_loop_count == 0)
+	{
+		Host::RequestVMShutdown(false, false, false);
+		s_dump_running = false;
+		return false;
+	}
+
+	return true;
+}
+
+/// Replaces the packet list with the next chunk of a streamed dump, wrapping around at the end.
+static bool GSDumpReplayerNextChunk()
+{
+	s_current_packet = 0;
+
+	Error error;
+	if (s_dump_file->ReadNextChunk(&error))
+		return true;
+
+	if (!error.IsValid())
+	{
+		if (!GSDumpReplayerEndOfDump())
+			return false;
+
+		if (s_dump_file->SeekToFrame(0, &error).has_value() && s_dump_file->ReadNextChunk(&error))
+			return true;
+	}
+
+	Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to read dump: {}", error.GetDescription()));
+	Host::RequestVMShutdown(false, false, false);
+	s_dump_running = false;
+	return false;
+}
+
 void GSDumpReplayerCpuStep()
 {
 	if (s_needs_state_loaded)
@@ -261,18 +336,23 @@ void GSDumpReplayerCpuStep()
 		s_needs_state_loaded = false;
 	}
 
+	if (s_dump_file->IsStreaming())
+	{
+		// The packet data belongs to the chunk, so only move on once the last one has been sent.
+		if (s_current_packet == s_dump_file->GetPackets().size() && !GSDumpReplayerNextChunk())
+			return;
+	}
+
 	const GSDumpFile::GSData& packet = s_dump_file->GetPackets()[s_current_packet];
-	s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
-	if (s_current_packet == 0)
+	if (s_dump_file->IsStreaming())
 	{
-		s_dump_frame_number = 0;
-		if (s_dump_loop_count > 0)
-			s_dump_loop_count--;
-		else if (s_dump_loop_count == 0)
-		{
-			Host::RequestVMShutdown(false, false, false);
-			s_dump_running = false;
-		}
+		s_current_packet++;
+	}
+	else
+	{
+		s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
+		if (s_current_packet == 0)
+			GSDumpReplayerEndOfDump();
 	}
 
 	switch (packet.id)
@@ -309,7 +389,10 @@ void GSDumpReplayerCpuStep()
 		{
 			s_dump_frame_number++;
 			GSDumpReplayerUpdateFrameLimit();
-			GSDumpReplayerFrameLimit();
+			if (s_dump_frame_number >= s_seek_target_frame)
+				GSDumpReplayerFrameLimit();
+			else
+				s_next_frame_time = GetCPUTicks();
 			MTGS::PostVsyncStart(false);
 			VMManager::Internal::VSyncOnCPUThread();
 			if (VMManager::Internal::IsExecutionInterrupted())
@@ -384,7 +467,10 @@ void GSDumpReplayer::RenderUI()
 		position_y += text_size.y + spacing; \
 	} while (0)
 
-	fmt::format_to(std::back_inserter(text), "Dump Frame: {}", s_dump_frame_number);
+	if (const u32 frame_count = s_dump_file->GetFrameCount(); frame_count > 0)
+		fmt::format_to(std::back_inserter(text), "Dump Frame: {}/{}", s_dump_frame_number, frame_count);
+	else
+		fmt::format_to(std::back_inserter(text), "Dump Frame: {}", s_dump_frame_number);
 	DRAW_LINE(font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 	text.clear();
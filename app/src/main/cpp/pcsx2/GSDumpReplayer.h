@@ -25,5 +25,12 @@ namespace GSDumpReplayer
 
 	u32 GetFrameNumber();
 
+	/// Returns the number of frames in the dump, or 0 if the format does not record it.
+	u32 GetFrameCount();
+
+	/// Restarts playback from the nearest keyframe and fast-forwards to the given frame.
+	/// Must be called on the CPU thread.
+	bool SeekToFrame(u32 frame);
+
 	void RenderUI();
 } // namespace GSDumpReplayer
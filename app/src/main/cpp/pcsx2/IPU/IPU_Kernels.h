@@ -0,0 +1,605 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-2.0+
+
+// The IDCT is based on the mpeg2dec library,
+//
+// Copyright (C) 2000-2002 Michel Lespinasse <walken@zoy.org>
+// Copyright (C) 1999-2000 Aaron Holtzman <aholtzma@ess.engr.uvic.ca>
+//
+// under the GPL license. However, it has been heavily rewritten for PCSX2 usage.
+
+#pragma once
+
+// Pixel kernels of the IPU, the portable reference versions next to the vectorized ones. They only
+// depend on their arguments, so the unit tests can check the two against each other.
+
+#include "common/Pcsx2Defs.h"
+#include "common/VectorIntrin.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+struct macroblock_rgb32{
+	struct {
+		u8 r, g, b, a;
+	} c[16][16];
+};
+
+struct rgb16_t{
+	u16 r:5, g:5, b:5, a:1;
+};
+
+struct macroblock_rgb16{
+	rgb16_t	c[16][16];
+};
+
+static constexpr std::array<u8, 1024> make_clip_lut()
+{
+	std::array<u8, 1024> lut = {};
+	for (int i = -384; i < 640; i++)
+		lut[i+384] = (i < 0) ? 0 : ((i > 255) ? 255 : i);
+	return lut;
+}
+
+alignas(16) inline constexpr std::array<u8, 1024> g_idct_clip_lut = make_clip_lut();
+
+// --------------------------------------------------------------------------------------
+//  IDCT
+// --------------------------------------------------------------------------------------
+#define W1 2841 /* 2048*sqrt (2)*cos (1*pi/16) */
+#define W2 2676 /* 2048*sqrt (2)*cos (2*pi/16) */
+#define W3 2408 /* 2048*sqrt (2)*cos (3*pi/16) */
+#define W5 1609 /* 2048*sqrt (2)*cos (5*pi/16) */
+#define W6 1108 /* 2048*sqrt (2)*cos (6*pi/16) */
+#define W7 565  /* 2048*sqrt (2)*cos (7*pi/16) */
+
+/*
+ * In legal streams, the IDCT output should be between -384 and +384.
+ * In corrupted streams, it is possible to force the IDCT output to go
+ * to +-3826 - this is the worst case for a column IDCT where the
+ * column inputs are 16-bit values.
+ */
+
+
+__fi static void BUTTERFLY(int& t0, int& t1, int w0, int w1, int d0, int d1)
+{
+	int tmp = w0 * (d0 + d1);
+	t0 = tmp + (w1 - w0) * d1;
+	t1 = tmp - (w1 + w0) * d0;
+}
+
+static inline void IDCT_Block_reference(s16* block)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		s16* const rblock = block + 8 * i;
+		if (!(rblock[1] | ((s32*)rblock)[1] | ((s32*)rblock)[2] |
+				((s32*)rblock)[3]))
+		{
+			u32 tmp = (u16)(rblock[0] << 3);
+			tmp |= tmp << 16;
+			((s32*)rblock)[0] = tmp;
+			((s32*)rblock)[1] = tmp;
+			((s32*)rblock)[2] = tmp;
+			((s32*)rblock)[3] = tmp;
+			continue;
+		}
+
+		int a0, a1, a2, a3;
+		{
+			const int d0 = (rblock[0] << 11) + 128;
+			const int d1 = rblock[1];
+			const int d2 = rblock[2] << 11;
+			const int d3 = rblock[3];
+			int t0 = d0 + d2;
+			int t1 = d0 - d2;
+			int t2, t3;
+			BUTTERFLY(t2, t3, W6, W2, d3, d1);
+			a0 = t0 + t2;
+			a1 = t1 + t3;
+			a2 = t1 - t3;
+			a3 = t0 - t2;
+		}
+
+		int b0, b1, b2, b3;
+		{
+			const int d0 = rblock[4];
+			const int d1 = rblock[5];
+			const int d2 = rblock[6];
+			const int d3 = rblock[7];
+			int t0, t1, t2, t3;
+			BUTTERFLY(t0, t1, W7, W1, d3, d0);
+			BUTTERFLY(t2, t3, W3, W5, d1, d2);
+			b0 = t0 + t2;
+			b3 = t1 + t3;
+			t0 -= t2;
+			t1 -= t3;
+			b1 = ((t0 + t1) * 181) >> 8;
+			b2 = ((t0 - t1) * 181) >> 8;
+		}
+
+		rblock[0] = (a0 + b0) >> 8;
+		rblock[1] = (a1 + b1) >> 8;
+		rblock[2] = (a2 + b2) >> 8;
+		rblock[3] = (a3 + b3) >> 8;
+		rblock[4] = (a3 - b3) >> 8;
+		rblock[5] = (a2 - b2) >> 8;
+		rblock[6] = (a1 - b1) >> 8;
+		rblock[7] = (a0 - b0) >> 8;
+	}
+
+	for (int i = 0; i < 8; i++)
+	{
+		s16* const cblock = block + i;
+
+		int a0, a1, a2, a3;
+		{
+			const int d0 = (cblock[8 * 0] << 11) + 65536;
+			const int d1 = cblock[8 * 1];
+			const int d2 = cblock[8 * 2] << 11;
+			const int d3 = cblock[8 * 3];
+			const int t0 = d0 + d2;
+			const int t1 = d0 - d2;
+			int t2;
+			int t3;
+			BUTTERFLY(t2, t3, W6, W2, d3, d1);
+			a0 = t0 + t2;
+			a1 = t1 + t3;
+			a2 = t1 - t3;
+			a3 = t0 - t2;
+		}
+
+		int b0, b1, b2, b3;
+		{
+			const int d0 = cblock[8 * 4];
+			const int d1 = cblock[8 * 5];
+			const int d2 = cblock[8 * 6];
+			const int d3 = cblock[8 * 7];
+			int t0, t1, t2, t3;
+			BUTTERFLY(t0, t1, W7, W1, d3, d0);
+			BUTTERFLY(t2, t3, W3, W5, d1, d2);
+			b0 = t0 + t2;
+			b3 = t1 + t3;
+			t0 = (t0 - t2) >> 8;
+			t1 = (t1 - t3) >> 8;
+			b1 = (t0 + t1) * 181;
+			b2 = (t0 - t1) * 181;
+		}
+
+		cblock[8 * 0] = (a0 + b0) >> 17;
+		cblock[8 * 1] = (a1 + b1) >> 17;
+		cblock[8 * 2] = (a2 + b2) >> 17;
+		cblock[8 * 3] = (a3 + b3) >> 17;
+		cblock[8 * 4] = (a3 - b3) >> 17;
+		cblock[8 * 5] = (a2 - b2) >> 17;
+		cblock[8 * 6] = (a1 - b1) >> 17;
+		cblock[8 * 7] = (a0 - b0) >> 17;
+	}
+}
+
+static inline void IDCT_Copy_reference(s16* block, u8* dest, const int stride)
+{
+	IDCT_Block_reference(block);
+
+	for (int i = 0; i < 8; i++)
+	{
+		dest[0] = (g_idct_clip_lut.data() + 384)[block[0]];
+		dest[1] = (g_idct_clip_lut.data() + 384)[block[1]];
+		dest[2] = (g_idct_clip_lut.data() + 384)[block[2]];
+		dest[3] = (g_idct_clip_lut.data() + 384)[block[3]];
+		dest[4] = (g_idct_clip_lut.data() + 384)[block[4]];
+		dest[5] = (g_idct_clip_lut.data() + 384)[block[5]];
+		dest[6] = (g_idct_clip_lut.data() + 384)[block[6]];
+		dest[7] = (g_idct_clip_lut.data() + 384)[block[7]];
+
+		std::memset(block, 0, 16);
+
+		dest += stride;
+		block += 8;
+	}
+}
+
+#if defined(_M_ARM64)
+
+// The NEON IDCT does the same integer arithmetic as the scalar one, four rows or columns per vector,
+// so the output is bit-exact. Rows with only a DC coefficient aren't special cased, the general
+// row transform produces the same value for them.
+
+__fi static void BUTTERFLY(int32x4_t& t0, int32x4_t& t1, int w0, int w1, int32x4_t d0, int32x4_t d1)
+{
+	const int32x4_t tmp = vmulq_n_s32(vaddq_s32(d0, d1), w0);
+	t0 = vmlaq_n_s32(tmp, d1, w1 - w0);
+	t1 = vmlsq_n_s32(tmp, d0, w1 + w0);
+}
+
+__fi static void IDCT_Transpose(int16x8_t (&v)[8])
+{
+	const int16x8x2_t t01 = vtrnq_s16(v[0], v[1]);
+	const int16x8x2_t t23 = vtrnq_s16(v[2], v[3]);
+	const int16x8x2_t t45 = vtrnq_s16(v[4], v[5]);
+	const int16x8x2_t t67 = vtrnq_s16(v[6], v[7]);
+	const int32x4x2_t u02 = vtrnq_s32(vreinterpretq_s32_s16(t01.val[0]), vreinterpretq_s32_s16(t23.val[0]));
+	const int32x4x2_t u13 = vtrnq_s32(vreinterpretq_s32_s16(t01.val[1]), vreinterpretq_s32_s16(t23.val[1]));
+	const int32x4x2_t u46 = vtrnq_s32(vreinterpretq_s32_s16(t45.val[0]), vreinterpretq_s32_s16(t67.val[0]));
+	const int32x4x2_t u57 = vtrnq_s32(vreinterpretq_s32_s16(t45.val[1]), vreinterpretq_s32_s16(t67.val[1]));
+
+	const auto lo = [](int32x4_t a, int32x4_t b) {
+		return vreinterpretq_s16_s64(vtrn1q_s64(vreinterpretq_s64_s32(a), vreinterpretq_s64_s32(b)));
+	};
+	const auto hi = [](int32x4_t a, int32x4_t b) {
+		return vreinterpretq_s16_s64(vtrn2q_s64(vreinterpretq_s64_s32(a), vreinterpretq_s64_s32(b)));
+	};
+	v[0] = lo(u02.val[0], u46.val[0]);
+	v[1] = lo(u13.val[0], u57.val[0]);
+	v[2] = lo(u02.val[1], u46.val[1]);
+	v[3] = lo(u13.val[1], u57.val[1]);
+	v[4] = hi(u02.val[0], u46.val[0]);
+	v[5] = hi(u13.val[0], u57.val[0]);
+	v[6] = hi(u02.val[1], u46.val[1]);
+	v[7] = hi(u13.val[1], u57.val[1]);
+}
+
+// One dimensional IDCT of four rows (or columns), x[n] holds coefficient n of each of them.
+template <bool column>
+__fi static void IDCT_Pass4(int32x4_t (&x)[8])
+{
+	int32x4_t a0, a1, a2, a3;
+	{
+		const int32x4_t d0 = vaddq_s32(vshlq_n_s32(x[0], 11), vdupq_n_s32(column ? 65536 : 128));
+		const int32x4_t d2 = vshlq_n_s32(x[2], 11);
+		const int32x4_t t0 = vaddq_s32(d0, d2);
+		const int32x4_t t1 = vsubq_s32(d0, d2);
+		int32x4_t t2, t3;
+		BUTTERFLY(t2, t3, W6, W2, x[3], x[1]);
+		a0 = vaddq_s32(t0, t2);
+		a1 = vaddq_s32(t1, t3);
+		a2 = vsubq_s32(t1, t3);
+		a3 = vsubq_s32(t0, t2);
+	}
+
+	int32x4_t b0, b1, b2, b3;
+	{
+		int32x4_t t0, t1, t2, t3;
+		BUTTERFLY(t0, t1, W7, W1, x[7], x[4]);
+		BUTTERFLY(t2, t3, W3, W5, x[5], x[6]);
+		b0 = vaddq_s32(t0, t2);
+		b3 = vaddq_s32(t1, t3);
+		t0 = vsubq_s32(t0, t2);
+		t1 = vsubq_s32(t1, t3);
+		if constexpr (column)
+		{
+			t0 = vshrq_n_s32(t0, 8);
+			t1 = vshrq_n_s32(t1, 8);
+			b1 = vmulq_n_s32(vaddq_s32(t0, t1), 181);
+			b2 = vmulq_n_s32(vsubq_s32(t0, t1), 181);
+		}
+		else
+		{
+			b1 = vshrq_n_s32(vmulq_n_s32(vaddq_s32(t0, t1), 181), 8);
+			b2 = vshrq_n_s32(vmulq_n_s32(vsubq_s32(t0, t1), 181), 8);
+		}
+	}
+
+	constexpr int shift = column ? 17 : 8;
+	x[0] = vshrq_n_s32(vaddq_s32(a0, b0), shift);
+	x[1] = vshrq_n_s32(vaddq_s32(a1, b1), shift);
+	x[2] = vshrq_n_s32(vaddq_s32(a2, b2), shift);
+	x[3] = vshrq_n_s32(vaddq_s32(a3, b3), shift);
+	x[4] = vshrq_n_s32(vsubq_s32(a3, b3), shift);
+	x[5] = vshrq_n_s32(vsubq_s32(a2, b2), shift);
+	x[6] = vshrq_n_s32(vsubq_s32(a1, b1), shift);
+	x[7] = vshrq_n_s32(vsubq_s32(a0, b0), shift);
+}
+
+// Transforms eight rows (or columns), v[n] holds coefficient n of each of them.
+// Results are truncated to 16 bits like the stores of the scalar version.
+template <bool column>
+__fi static void IDCT_Pass(int16x8_t (&v)[8])
+{
+	int32x4_t lo[8], hi[8];
+	for (int i = 0; i < 8; i++)
+	{
+		lo[i] = vmovl_s16(vget_low_s16(v[i]));
+		hi[i] = vmovl_high_s16(v[i]);
+	}
+
+	IDCT_Pass4<column>(lo);
+	IDCT_Pass4<column>(hi);
+
+	for (int i = 0; i < 8; i++)
+		v[i] = vcombine_s16(vmovn_s32(lo[i]), vmovn_s32(hi[i]));
+}
+
+// Returns the transformed rows of the block in registers, leaving the block itself untouched.
+__fi static void IDCT_Rows(const s16* block, int16x8_t (&rows)[8])
+{
+	for (int i = 0; i < 8; i++)
+		rows[i] = vld1q_s16(block + 8 * i);
+
+	IDCT_Transpose(rows);
+	IDCT_Pass<false>(rows);
+	IDCT_Transpose(rows);
+	IDCT_Pass<true>(rows);
+}
+
+static inline void IDCT_Block_neon(s16* block)
+{
+	int16x8_t rows[8];
+	IDCT_Rows(block, rows);
+	for (int i = 0; i < 8; i++)
+		vst1q_s16(block + 8 * i, rows[i]);
+}
+
+static inline void IDCT_Copy_neon(s16* block, u8* dest, const int stride)
+{
+	int16x8_t rows[8];
+	IDCT_Rows(block, rows);
+
+	// Saturating narrow clips to 0..255 without the table lookups.
+	const int16x8_t zero = vdupq_n_s16(0);
+	for (int i = 0; i < 8; i++)
+	{
+		vst1_u8(dest, vqmovun_s16(rows[i]));
+		vst1q_s16(block + 8 * i, zero);
+		dest += stride;
+	}
+}
+
+#endif
+
+#undef W1
+#undef W2
+#undef W3
+#undef W5
+#undef W6
+#undef W7
+
+// --------------------------------------------------------------------------------------
+//  CSC thresholds, VQ and dithering
+// --------------------------------------------------------------------------------------
+
+/// Clears pixels below thresh[0], gives the ones below thresh[1] an alpha of 0x40, and applies the
+/// pseudo sign offset.
+static inline void ipu_csc_thresh_reference(macroblock_rgb32& rgb32, const u16 (&thresh)[2], int sgn)
+{
+	int i;
+	u8* p = (u8*)&rgb32;
+
+	if (thresh[0] > 0)
+	{
+		for (i = 0; i < 16*16; i++, p += 4)
+		{
+			if ((p[0] < thresh[0]) && (p[1] < thresh[0]) && (p[2] < thresh[0]))
+				*(u32*)p = 0;
+			else if ((p[0] < thresh[1]) && (p[1] < thresh[1]) && (p[2] < thresh[1]))
+				p[3] = 0x40;
+		}
+	}
+	else if (thresh[1] > 0)
+	{
+		for (i = 0; i < 16*16; i++, p += 4)
+		{
+			if ((p[0] < thresh[1]) && (p[1] < thresh[1]) && (p[2] < thresh[1]))
+				p[3] = 0x40;
+		}
+	}
+	if (sgn)
+	{
+		p = (u8*)&rgb32;
+		for (i = 0; i < 16*16; i++, p += 4)
+		{
+			*(u32*)p ^= 0x808080;
+		}
+	}
+}
+
+/// Packs the index of the closest CLUT colour of every pixel into indx4, two pixels per byte.
+static inline void ipu_vq_reference(const macroblock_rgb16& rgb16, const rgb16_t (&clut)[16], u8* indx4)
+{
+	const auto closest_index = [&](int i, int j) {
+		u8 index = 0;
+		int min_distance = std::numeric_limits<int>::max();
+		for (u8 k = 0; k < 16; ++k)
+		{
+			const int dr = rgb16.c[i][j].r - clut[k].r;
+			const int dg = rgb16.c[i][j].g - clut[k].g;
+			const int db = rgb16.c[i][j].b - clut[k].b;
+			const int distance = dr * dr + dg * dg + db * db;
+
+			// XXX: If two distances are the same which index is used?
+			if (min_distance > distance)
+			{
+				index = k;
+				min_distance = distance;
+			}
+		}
+
+		return index;
+	};
+
+	for (int i = 0; i < 16; ++i)
+		for (int j = 0; j < 8; ++j)
+			indx4[i * 8 + j] = closest_index(i, 2 * j + 1) << 4 | closest_index(i, 2 * j);
+}
+
+static inline void ipu_dither_reference(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte)
+{
+	if (dte) {
+		// I'm guessing values are rounded down when clamping.
+		const int dither_coefficient[4][4] = {
+			{-4, 0, -3, 1},
+			{2, -2, 3, -1},
+			{-3, 1, -4, 0},
+			{3, -1, 2, -2},
+		};
+		for (int i = 0; i < 16; ++i) {
+			for (int j = 0; j < 16; ++j) {
+				const int dither = dither_coefficient[i & 3][j & 3];
+				const int r = std::max(0, std::min(rgb32.c[i][j].r + dither, 255));
+				const int g = std::max(0, std::min(rgb32.c[i][j].g + dither, 255));
+				const int b = std::max(0, std::min(rgb32.c[i][j].b + dither, 255));
+
+				rgb16.c[i][j].r = r >> 3;
+				rgb16.c[i][j].g = g >> 3;
+				rgb16.c[i][j].b = b >> 3;
+				rgb16.c[i][j].a = rgb32.c[i][j].a == 0x40;
+			}
+		}
+	} else {
+		for (int i = 0; i < 16; ++i) {
+			for (int j = 0; j < 16; ++j) {
+				rgb16.c[i][j].r = rgb32.c[i][j].r >> 3;
+				rgb16.c[i][j].g = rgb32.c[i][j].g >> 3;
+				rgb16.c[i][j].b = rgb32.c[i][j].b >> 3;
+				rgb16.c[i][j].a = rgb32.c[i][j].a == 0x40;
+			}
+		}
+	}
+}
+
+#if defined(_M_ARM64)
+
+static inline void ipu_csc_thresh_neon(macroblock_rgb32& rgb32, const u16 (&thresh)[2], int sgn)
+{
+	if (thresh[0] == 0 && thresh[1] == 0 && !sgn)
+		return;
+
+	// x < thresh as x <= thresh - 1, thresholds are 9 bits so anything from 256 up matches every value.
+	const uint8x16_t thresh0 = vdupq_n_u8(static_cast<u8>(std::min<u16>(thresh[0], 256) - 1));
+	const uint8x16_t thresh1 = vdupq_n_u8(static_cast<u8>(std::min<u16>(thresh[1], 256) - 1));
+	const uint8x16_t alpha = vdupq_n_u8(0x40);
+	const uint8x16_t sign = vdupq_n_u8(0x80);
+
+	for (int i = 0; i < 16; i++)
+	{
+		u8* const row = reinterpret_cast<u8*>(&rgb32.c[i][0]);
+		uint8x16x4_t px = vld4q_u8(row);
+
+		if (thresh[1] > 0)
+		{
+			const uint8x16_t below = vandq_u8(vandq_u8(vcleq_u8(px.val[0], thresh1), vcleq_u8(px.val[1], thresh1)),
+				vcleq_u8(px.val[2], thresh1));
+			px.val[3] = vbslq_u8(below, alpha, px.val[3]);
+		}
+
+		// Applied after the alpha, so pixels below both thresholds end up fully cleared.
+		if (thresh[0] > 0)
+		{
+			const uint8x16_t below = vandq_u8(vandq_u8(vcleq_u8(px.val[0], thresh0), vcleq_u8(px.val[1], thresh0)),
+				vcleq_u8(px.val[2], thresh0));
+			px.val[0] = vbicq_u8(px.val[0], below);
+			px.val[1] = vbicq_u8(px.val[1], below);
+			px.val[2] = vbicq_u8(px.val[2], below);
+			px.val[3] = vbicq_u8(px.val[3], below);
+		}
+
+		if (sgn)
+		{
+			px.val[0] = veorq_u8(px.val[0], sign);
+			px.val[1] = veorq_u8(px.val[1], sign);
+			px.val[2] = veorq_u8(px.val[2], sign);
+		}
+
+		vst4q_u8(row, px);
+	}
+}
+
+static inline void ipu_vq_neon(const macroblock_rgb16& rgb16, const rgb16_t (&clut)[16], u8* indx4)
+{
+	// A whole row of pixels is matched against each CLUT entry at once. Channels are 5 bits, so the
+	// squared distances fit in 16 bits, and a strict compare keeps the lowest index on ties like above.
+	u8 clut_r[16], clut_g[16], clut_b[16];
+	for (int k = 0; k < 16; k++)
+	{
+		clut_r[k] = clut[k].r;
+		clut_g[k] = clut[k].g;
+		clut_b[k] = clut[k].b;
+	}
+
+	const uint16x8_t mask5 = vdupq_n_u16(0x1f);
+	for (int i = 0; i < 16; i++)
+	{
+		const uint16x8_t p0 = vld1q_u16(reinterpret_cast<const u16*>(&rgb16.c[i][0]));
+		const uint16x8_t p1 = vld1q_u16(reinterpret_cast<const u16*>(&rgb16.c[i][8]));
+		const uint8x16_t r = vcombine_u8(vmovn_u16(vandq_u16(p0, mask5)), vmovn_u16(vandq_u16(p1, mask5)));
+		const uint8x16_t g = vcombine_u8(vmovn_u16(vandq_u16(vshrq_n_u16(p0, 5), mask5)),
+			vmovn_u16(vandq_u16(vshrq_n_u16(p1, 5), mask5)));
+		const uint8x16_t b = vcombine_u8(vmovn_u16(vandq_u16(vshrq_n_u16(p0, 10), mask5)),
+			vmovn_u16(vandq_u16(vshrq_n_u16(p1, 10), mask5)));
+
+		uint16x8_t min_lo = vdupq_n_u16(0xffff), min_hi = vdupq_n_u16(0xffff);
+		uint16x8_t index_lo = vdupq_n_u16(0), index_hi = vdupq_n_u16(0);
+		for (int k = 0; k < 16; k++)
+		{
+			const uint8x16_t dr = vabdq_u8(r, vdupq_n_u8(clut_r[k]));
+			const uint8x16_t dg = vabdq_u8(g, vdupq_n_u8(clut_g[k]));
+			const uint8x16_t db = vabdq_u8(b, vdupq_n_u8(clut_b[k]));
+
+			uint16x8_t dist_lo = vmull_u8(vget_low_u8(dr), vget_low_u8(dr));
+			dist_lo = vmlal_u8(dist_lo, vget_low_u8(dg), vget_low_u8(dg));
+			dist_lo = vmlal_u8(dist_lo, vget_low_u8(db), vget_low_u8(db));
+			uint16x8_t dist_hi = vmull_high_u8(dr, dr);
+			dist_hi = vmlal_high_u8(dist_hi, dg, dg);
+			dist_hi = vmlal_high_u8(dist_hi, db, db);
+
+			const uint16x8_t closer_lo = vcltq_u16(dist_lo, min_lo);
+			const uint16x8_t closer_hi = vcltq_u16(dist_hi, min_hi);
+			min_lo = vminq_u16(min_lo, dist_lo);
+			min_hi = vminq_u16(min_hi, dist_hi);
+			index_lo = vbslq_u16(closer_lo, vdupq_n_u16(k), index_lo);
+			index_hi = vbslq_u16(closer_hi, vdupq_n_u16(k), index_hi);
+		}
+
+		// Pairs of indices are packed into bytes, the odd pixel in the high nibble.
+		const uint16x8_t pairs = vreinterpretq_u16_u8(vcombine_u8(vmovn_u16(index_lo), vmovn_u16(index_hi)));
+		vst1_u8(indx4 + i * 8, vmovn_u16(vorrq_u16(pairs, vshrq_n_u16(pairs, 4))));
+	}
+}
+
+static inline void ipu_dither_neon(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte)
+{
+	// Same saturating add/subtract split of the dither matrix as the SSE2 version, one row per iteration.
+	alignas(16) static constexpr u8 dither_add_matrix[4][16] = {
+		{0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1},
+		{2, 0, 3, 0, 2, 0, 3, 0, 2, 0, 3, 0, 2, 0, 3, 0},
+		{0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0},
+		{3, 0, 2, 0, 3, 0, 2, 0, 3, 0, 2, 0, 3, 0, 2, 0},
+	};
+	alignas(16) static constexpr u8 dither_sub_matrix[4][16] = {
+		{4, 0, 3, 0, 4, 0, 3, 0, 4, 0, 3, 0, 4, 0, 3, 0},
+		{0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1},
+		{3, 0, 4, 0, 3, 0, 4, 0, 3, 0, 4, 0, 3, 0, 4, 0},
+		{0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2},
+	};
+	const uint8x16_t alpha_test = vdupq_n_u8(0x40);
+	for (int i = 0; i < 16; ++i) {
+		// Splits the row into one register per channel.
+		uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const u8 *>(&rgb32.c[i][0]));
+
+		// Dither and clamp
+		if (dte) {
+			const uint8x16_t dither_add = vld1q_u8(dither_add_matrix[i & 3]);
+			const uint8x16_t dither_sub = vld1q_u8(dither_sub_matrix[i & 3]);
+			for (int c = 0; c < 3; ++c)
+				rgba.val[c] = vqsubq_u8(vqaddq_u8(rgba.val[c], dither_add), dither_sub);
+		}
+
+		const uint8x16_t r = vshrq_n_u8(rgba.val[0], 3);
+		const uint8x16_t g = vshrq_n_u8(rgba.val[1], 3);
+		const uint8x16_t b = vshrq_n_u8(rgba.val[2], 3);
+		const uint8x16_t a = vshrq_n_u8(vceqq_u8(rgba.val[3], alpha_test), 7);
+
+		// Create RGBA
+		const uint16x8_t rgba16_lo = vorrq_u16(vorrq_u16(vmovl_u8(vget_low_u8(r)), vshll_n_u8(vget_low_u8(g), 5)),
+			vorrq_u16(vshlq_n_u16(vmovl_u8(vget_low_u8(b)), 10), vshlq_n_u16(vmovl_u8(vget_low_u8(a)), 15)));
+		const uint16x8_t rgba16_hi = vorrq_u16(vorrq_u16(vmovl_high_u8(r), vshll_high_n_u8(g, 5)),
+			vorrq_u16(vshlq_n_u16(vmovl_high_u8(b), 10), vshlq_n_u16(vmovl_high_u8(a), 15)));
+
+		vst1q_u16(reinterpret_cast<u16 *>(&rgb16.c[i][0]), rgba16_lo);
+		vst1q_u16(reinterpret_cast<u16 *>(&rgb16.c[i][8]), rgba16_hi);
+	}
+}
+
+#endif
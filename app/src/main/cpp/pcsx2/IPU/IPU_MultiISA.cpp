@@ -19,14 +19,6 @@ static const uint decoder_stride = 16;
 
 #if MULTI_ISA_COMPILE_ONCE
 
-static constexpr std::array<u8, 1024> make_clip_lut()
-{
-	std::array<u8, 1024> lut = {};
-	for (int i = -384; i < 640; i++)
-		lut[i+384] = (i < 0) ? 0 : ((i > 255) ? 255 : i);
-	return lut;
-}
-
 static constexpr mpeg2_scan_pack make_scan_pack()
 {
 	constexpr u8 mpeg2_scan_norm[64] = {
@@ -57,7 +49,6 @@ static constexpr mpeg2_scan_pack make_scan_pack()
 	return pack;
 }
 
-alignas(16) const std::array<u8, 1024> g_idct_clip_lut = make_clip_lut();
 alignas(16) const mpeg2_scan_pack mpeg2_scan = make_scan_pack();
 
 #endif
@@ -192,159 +183,24 @@ __ri static u8 getBits8(u8 *address, bool advance)
 }
 
 
-#define W1 2841 /* 2048*sqrt (2)*cos (1*pi/16) */
-#define W2 2676 /* 2048*sqrt (2)*cos (2*pi/16) */
-#define W3 2408 /* 2048*sqrt (2)*cos (3*pi/16) */
-#define W5 1609 /* 2048*sqrt (2)*cos (5*pi/16) */
-#define W6 1108 /* 2048*sqrt (2)*cos (6*pi/16) */
-#define W7 565  /* 2048*sqrt (2)*cos (7*pi/16) */
-
-/*
- * In legal streams, the IDCT output should be between -384 and +384.
- * In corrupted streams, it is possible to force the IDCT output to go
- * to +-3826 - this is the worst case for a column IDCT where the
- * column inputs are 16-bit values.
- */
-
-__fi static void BUTTERFLY(int& t0, int& t1, int w0, int w1, int d0, int d1)
-{
-	int tmp = w0 * (d0 + d1);
-	t0 = tmp + (w1 - w0) * d1;
-	t1 = tmp - (w1 + w0) * d0;
-}
-
 __ri static void IDCT_Block(s16* block)
 {
-	for (int i = 0; i < 8; i++)
-	{
-		s16* const rblock = block + 8 * i;
-		if (!(rblock[1] | ((s32*)rblock)[1] | ((s32*)rblock)[2] |
-				((s32*)rblock)[3]))
-		{
-			u32 tmp = (u16)(rblock[0] << 3);
-			tmp |= tmp << 16;
-			((s32*)rblock)[0] = tmp;
-			((s32*)rblock)[1] = tmp;
-			((s32*)rblock)[2] = tmp;
-			((s32*)rblock)[3] = tmp;
-			continue;
-		}
-
-		int a0, a1, a2, a3;
-		{
-			const int d0 = (rblock[0] << 11) + 128;
-			const int d1 = rblock[1];
-			const int d2 = rblock[2] << 11;
-			const int d3 = rblock[3];
-			int t0 = d0 + d2;
-			int t1 = d0 - d2;
-			int t2, t3;
-			BUTTERFLY(t2, t3, W6, W2, d3, d1);
-			a0 = t0 + t2;
-			a1 = t1 + t3;
-			a2 = t1 - t3;
-			a3 = t0 - t2;
-		}
-
-		int b0, b1, b2, b3;
-		{
-			const int d0 = rblock[4];
-			const int d1 = rblock[5];
-			const int d2 = rblock[6];
-			const int d3 = rblock[7];
-			int t0, t1, t2, t3;
-			BUTTERFLY(t0, t1, W7, W1, d3, d0);
-			BUTTERFLY(t2, t3, W3, W5, d1, d2);
-			b0 = t0 + t2;
-			b3 = t1 + t3;
-			t0 -= t2;
-			t1 -= t3;
-			b1 = ((t0 + t1) * 181) >> 8;
-			b2 = ((t0 - t1) * 181) >> 8;
-		}
-
-		rblock[0] = (a0 + b0) >> 8;
-		rblock[1] = (a1 + b1) >> 8;
-		rblock[2] = (a2 + b2) >> 8;
-		rblock[3] = (a3 + b3) >> 8;
-		rblock[4] = (a3 - b3) >> 8;
-		rblock[5] = (a2 - b2) >> 8;
-		rblock[6] = (a1 - b1) >> 8;
-		rblock[7] = (a0 - b0) >> 8;
-	}
-
-	for (int i = 0; i < 8; i++)
-	{
-		s16* const cblock = block + i;
-
-		int a0, a1, a2, a3;
-		{
-			const int d0 = (cblock[8 * 0] << 11) + 65536;
-			const int d1 = cblock[8 * 1];
-			const int d2 = cblock[8 * 2] << 11;
-			const int d3 = cblock[8 * 3];
-			const int t0 = d0 + d2;
-			const int t1 = d0 - d2;
-			int t2;
-			int t3;
-			BUTTERFLY(t2, t3, W6, W2, d3, d1);
-			a0 = t0 + t2;
-			a1 = t1 + t3;
-			a2 = t1 - t3;
-			a3 = t0 - t2;
-		}
-
-		int b0, b1, b2, b3;
-		{
-			const int d0 = cblock[8 * 4];
-			const int d1 = cblock[8 * 5];
-			const int d2 = cblock[8 * 6];
-			const int d3 = cblock[8 * 7];
-			int t0, t1, t2, t3;
-			BUTTERFLY(t0, t1, W7, W1, d3, d0);
-			BUTTERFLY(t2, t3, W3, W5, d1, d2);
-			b0 = t0 + t2;
-			b3 = t1 + t3;
-			t0 = (t0 - t2) >> 8;
-			t1 = (t1 - t3) >> 8;
-			b1 = (t0 + t1) * 181;
-			b2 = (t0 - t1) * 181;
-		}
-
-		cblock[8 * 0] = (a0 + b0) >> 17;
-		cblock[8 * 1] = (a1 + b1) >> 17;
-		cblock[8 * 2] = (a2 + b2) >> 17;
-		cblock[8 * 3] = (a3 + b3) >> 17;
-		cblock[8 * 4] = (a3 - b3) >> 17;
-		cblock[8 * 5] = (a2 - b2) >> 17;
-		cblock[8 * 6] = (a1 - b1) >> 17;
-		cblock[8 * 7] = (a0 - b0) >> 17;
-	}
+#if defined(_M_ARM64)
+	IDCT_Block_neon(block);
+#else
+	IDCT_Block_reference(block);
+#endif
 }
 
 __ri static void IDCT_Copy(s16* block, u8* dest, const int stride)
 {
-	IDCT_Block(block);
-
-	for (int i = 0; i < 8; i++)
-	{
-		dest[0] = (g_idct_clip_lut.data() + 384)[block[0]];
-		dest[1] = (g_idct_clip_lut.data() + 384)[block[1]];
-		dest[2] = (g_idct_clip_lut.data() + 384)[block[2]];
-		dest[3] = (g_idct_clip_lut.data() + 384)[block[3]];
-		dest[4] = (g_idct_clip_lut.data() + 384)[block[4]];
-		dest[5] = (g_idct_clip_lut.data() + 384)[block[5]];
-		dest[6] = (g_idct_clip_lut.data() + 384)[block[6]];
-		dest[7] = (g_idct_clip_lut.data() + 384)[block[7]];
-
-		std::memset(block, 0, 16);
-
-		dest += stride;
-		block += 8;
-	}
+#if defined(_M_ARM64)
+	IDCT_Copy_neon(block, dest, stride);
+#else
+	IDCT_Copy_reference(block, dest, stride);
+#endif
 }
 
-
 // stride = increment for dest in 16-bit units (typically either 8 [128 bits] or 16 [256 bits]).
 __ri static void IDCT_Add(const int last, s16* block, s16* dest, const int stride)
 {
@@ -375,6 +231,46 @@ __ri static void IDCT_Add(const int last, s16* block, s16* dest, const int strid
 	}
 }
 
+// --------------------------------------------------------------------------------------
+//  FMV fast path
+// --------------------------------------------------------------------------------------
+// Decoded macroblocks normally trickle through the 8 QWC output FIFO, with a DMA and an IPU interrupt
+// for every FIFO load (6 per BDEC macroblock, 8 per IDEC one). When IPU0 is streaming into main memory
+// with room for the rest of the macroblock, the fast path writes it there in one go and lets the
+// command carry on. The data is the same, only the DMA timing within the macroblock is lost.
+
+/// Writes what's left of the output macroblock to the IPU0 destination, returns false if the FIFO has to be used.
+__ri static bool DirectOutputMacroblock()
+{
+	const uint size = decoder.ipu0_data;
+	if (!EmuConfig.Speedhacks.fmvFastPath || ipuRegs.ctrl.OFC != 0 || !ipu0ch.chcr.STR ||
+		ipu0ch.chcr.MOD != NORMAL_MODE || ipu0ch.qwc < size || (cpuRegs.interrupt & (1 << DMAC_FROM_IPU)))
+	{
+		return false;
+	}
+
+	// Scratchpad and the other DMA targets wrap or are registers, leave those to IPU0dma().
+	const u32 addr = ipu0ch.madr & 0x1ffffff0;
+	if (DMA_TAG(ipu0ch.madr).SPR || addr + (size << 4) > Ps2MemSize::ExposedRam)
+		return false;
+
+	std::memcpy(dmaGetAddr(ipu0ch.madr, true), decoder.GetIpuDataPtr(), size << 4);
+	decoder.AdvanceIpuDataBy(size);
+
+	ipu0ch.madr += size << 4;
+	ipu0ch.qwc -= size;
+
+	if (dmacRegs.ctrl.STS == STS_fromIPU)
+		dmacRegs.stadr.ADDR = ipu0ch.madr;
+
+	// Lets ipu0Interrupt() end the transfer, as IPU0dma() does once the last quadword has been read.
+	if (!ipu0ch.qwc)
+		IPU_INT_FROM(size * BIAS);
+
+	CPU_SET_DMASTALL(DMAC_FROM_IPU, true);
+	return true;
+}
+
 /* Bitstream and buffer needs to be reallocated in order for successful
 	reading of the old data. Here the old data stored in the 2nd slot
 	of the internal buffer is copied to 1st slot, and the new data read
@@ -1108,7 +1004,7 @@ __ri static bool mpeg2sliceIDEC()
 					return false;
 				}
 				pxAssert(decoder.ipu0_data > 0);
-				uint read = ipu_fifo.out.write((u32*)decoder.GetIpuDataPtr(), decoder.ipu0_data);
+				uint read = DirectOutputMacroblock() ? 0 : ipu_fifo.out.write((u32*)decoder.GetIpuDataPtr(), decoder.ipu0_data);
 				decoder.AdvanceIpuDataBy(read);
 
 				if (decoder.ipu0_data != 0)
@@ -1523,7 +1419,7 @@ __fi static bool mpeg2_slice()
 		}
 
 		pxAssert(decoder.ipu0_data > 0);
-		uint read = ipu_fifo.out.write((u32*)decoder.GetIpuDataPtr(), decoder.ipu0_data);
+		uint read = DirectOutputMacroblock() ? 0 : ipu_fifo.out.write((u32*)decoder.GetIpuDataPtr(), decoder.ipu0_data);
 		decoder.AdvanceIpuDataBy(read);
 
 		if (decoder.ipu0_data != 0)
@@ -1877,64 +1773,22 @@ __ri static bool ipuPACK(tIPU_CMD_CSC csc)
 
 __fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 {
-	int i;
-	u8* p = (u8*)&rgb32;
-
 	yuv2rgb();
 
-	if (g_ipu_thresh[0] > 0)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			if ((p[0] < g_ipu_thresh[0]) && (p[1] < g_ipu_thresh[0]) && (p[2] < g_ipu_thresh[0]))
-				*(u32*)p = 0;
-			else if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
-				p[3] = 0x40;
-		}
-	}
-	else if (g_ipu_thresh[1] > 0)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
-				p[3] = 0x40;
-		}
-	}
-	if (sgn)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			*(u32*)p ^= 0x808080;
-		}
-	}
+#if defined(_M_ARM64)
+	ipu_csc_thresh_neon(rgb32, g_ipu_thresh, sgn);
+#else
+	ipu_csc_thresh_reference(rgb32, g_ipu_thresh, sgn);
+#endif
 }
 
 __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 {
-	const auto closest_index = [&](int i, int j) {
-		u8 index = 0;
-		int min_distance = std::numeric_limits<int>::max();
-		for (u8 k = 0; k < 16; ++k)
-		{
-			const int dr = rgb16.c[i][j].r - g_ipu_vqclut[k].r;
-			const int dg = rgb16.c[i][j].g - g_ipu_vqclut[k].g;
-			const int db = rgb16.c[i][j].b - g_ipu_vqclut[k].b;
-			const int distance = dr * dr + dg * dg + db * db;
-
-			// XXX: If two distances are the same which index is used?
-			if (min_distance > distance)
-			{
-				index = k;
-				min_distance = distance;
-			}
-		}
-
-		return index;
-	};
-
-	for (int i = 0; i < 16; ++i)
-		for (int j = 0; j < 8; ++j)
-			indx4[i * 8 + j] = closest_index(i, 2 * j + 1) << 4 | closest_index(i, 2 * j);
+#if defined(_M_ARM64)
+	ipu_vq_neon(rgb16, g_ipu_vqclut, indx4);
+#else
+	ipu_vq_reference(rgb16, g_ipu_vqclut, indx4);
+#endif
 }
 
 __noinline void IPUWorker()
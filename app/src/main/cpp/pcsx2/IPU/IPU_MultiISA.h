@@ -4,6 +4,7 @@
 #pragma once
 
 #include "IPU/IPU.h"
+#include "IPU/IPU_Kernels.h"
 #include "IPU/mpeg2_vlc.h"
 #include "GS/MultiISA.h"
 
@@ -35,20 +36,6 @@ struct macroblock_16{
 	s16 Cr[8][8];			//2
 };
 
-struct macroblock_rgb32{
-	struct {
-		u8 r, g, b, a;
-	} c[16][16];
-};
-
-struct rgb16_t{
-	u16 r:5, g:5, b:5, a:1;
-};
-
-struct macroblock_rgb16{
-	rgb16_t	c[16][16];
-};
-
 struct decoder_t {
 	/* first, state that carries information from one macroblock to the */
 	/* next inside a slice, and is never used outside of mpeg2_slice() */
@@ -161,5 +148,4 @@ struct mpeg2_scan_pack
 	u8 alt[64];
 };
 
-alignas(16) extern const std::array<u8, 1024> g_idct_clip_lut;
 alignas(16) extern const mpeg2_scan_pack mpeg2_scan;
@@ -10,8 +10,6 @@
 
 MULTI_ISA_UNSHARED_START
 
-void ipu_dither_reference(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte);
-
 #if defined(_M_X86)
 void ipu_dither_sse2(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte);
 #endif
@@ -20,46 +18,13 @@ __ri void ipu_dither(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int
 {
 #if defined(_M_X86)
     ipu_dither_sse2(rgb32, rgb16, dte);
+#elif defined(_M_ARM64)
+    ipu_dither_neon(rgb32, rgb16, dte);
 #else
     ipu_dither_reference(rgb32, rgb16, dte);
 #endif
 }
 
-__ri void ipu_dither_reference(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte)
-{
-    if (dte) {
-        // I'm guessing values are rounded down when clamping.
-        const int dither_coefficient[4][4] = {
-            {-4, 0, -3, 1},
-            {2, -2, 3, -1},
-            {-3, 1, -4, 0},
-            {3, -1, 2, -2},
-        };
-        for (int i = 0; i < 16; ++i) {
-            for (int j = 0; j < 16; ++j) {
-                const int dither = dither_coefficient[i & 3][j & 3];
-                const int r = std::max(0, std::min(rgb32.c[i][j].r + dither, 255));
-                const int g = std::max(0, std::min(rgb32.c[i][j].g + dither, 255));
-                const int b = std::max(0, std::min(rgb32.c[i][j].b + dither, 255));
-
-                rgb16.c[i][j].r = r >> 3;
-                rgb16.c[i][j].g = g >> 3;
-                rgb16.c[i][j].b = b >> 3;
-                rgb16.c[i][j].a = rgb32.c[i][j].a == 0x40;
-            }
-        }
-    } else {
-        for (int i = 0; i < 16; ++i) {
-            for (int j = 0; j < 16; ++j) {
-                rgb16.c[i][j].r = rgb32.c[i][j].r >> 3;
-                rgb16.c[i][j].g = rgb32.c[i][j].g >> 3;
-                rgb16.c[i][j].b = rgb32.c[i][j].b >> 3;
-                rgb16.c[i][j].a = rgb32.c[i][j].a == 0x40;
-            }
-        }
-    }
-}
-
 #if defined(_M_X86)
 
 __ri void ipu_dither_sse2(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte)
@@ -310,7 +310,9 @@ __forceinline static s32 GaussianInterpolate(s32 pv4, s32 pv3, s32 pv2, s32 pv1,
 	return out;
 }
 
-static __forceinline s32 GetVoiceValues(V_Core& thiscore, uint voiceidx)
+// Reads the samples the sample pointer has moved past, and returns the index of the interpolation
+// coefficients for the new position.
+static __forceinline s32 AdvanceVoice(V_Core& thiscore, uint voiceidx)
 {
 	V_Voice& vc(thiscore.Voices[voiceidx]);
 
@@ -325,7 +327,15 @@ static __forceinline s32 GetVoiceValues(V_Core& thiscore, uint voiceidx)
 
 	const s32 mu = vc.SP + 0x1000;
 
-	return GaussianInterpolate(vc.PV4, vc.PV3, vc.PV2, vc.PV1, (mu & 0x0ff0) >> 4);
+	return (mu & 0x0ff0) >> 4;
+}
+
+static __forceinline s32 GetVoiceValues(V_Core& thiscore, uint voiceidx)
+{
+	const s32 i = AdvanceVoice(thiscore, voiceidx);
+	const V_Voice& vc(thiscore.Voices[voiceidx]);
+
+	return GaussianInterpolate(vc.PV4, vc.PV3, vc.PV2, vc.PV1, i);
 }
 
 // This is Dr. Hell's noise algorithm as implemented in pcsxr
@@ -457,20 +467,177 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 const VoiceMixSet VoiceMixSet::Empty((StereoOut32()), (StereoOut32())); // Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
-static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
+// Voice state for one output sample in structure-of-arrays form. The stateful part of mixing (ADPCM
+// decoding, loop points, IRQs, envelopes and volume slides) runs one voice at a time and fills this in,
+// then interpolation, envelope and volume are applied to all voices of the core at once.
+struct VoiceBatch
 {
+	// Gaussian interpolation coefficients and the samples they apply to, PV4 first.
+	alignas(16) s16 Coef[4][V_Core::NumVoices];
+	alignas(16) s16 Sample[4][V_Core::NumVoices];
+	// Added to the interpolated value, holds the noise of noise voices, whose coefficients are zero.
+	alignas(16) s32 Base[V_Core::NumVoices];
+	// Envelope and volumes after this sample's update, zero for stopped voices.
+	alignas(16) s32 Envelope[V_Core::NumVoices];
+	alignas(16) s32 VolumeL[V_Core::NumVoices];
+	alignas(16) s32 VolumeR[V_Core::NumVoices];
+	// Voice output after the envelope (OutX).
+	alignas(16) s32 Value[V_Core::NumVoices];
+	bool Active[V_Core::NumVoices];
+};
+
+// Interpolated value of one voice of the batch with the envelope applied, as computed by MixVoiceBatch().
+static __forceinline s32 GetBatchValue(const VoiceBatch& batch, uint voiceidx)
+{
+	s32 value = batch.Base[voiceidx];
+	for (int i = 0; i < 4; i++)
+		value += (batch.Coef[i][voiceidx] * batch.Sample[i][voiceidx]) >> 15;
+
+	return ApplyVolume(value, batch.Envelope[voiceidx]);
+}
+
+// Does everything MixVoice() does before the interpolation math, which is left to MixVoiceBatch().
+static __forceinline void GatherVoice(VoiceBatch& batch, uint coreidx, uint voiceidx)
+{
+	static constexpr std::array<s16, 4> silence = {};
+
 	V_Core& thiscore(Cores[coreidx]);
+	V_Voice& vc(thiscore.Voices[voiceidx]);
+
+	pxAssertMsg((vc.SCurrent <= 28) && (vc.SCurrent != 0), "Current sample should always range from 1->28");
 
+	vc.Volume.Update();
+	UpdatePitch(coreidx, voiceidx);
+
+	const std::array<s16, 4>* coef = &silence;
+	s32 base = 0;
+	s32 envelope = 0;
+	const bool active = (vc.ADSR.Phase > V_ADSR::PHASE_STOPPED);
+	if (active)
+	{
+		if (vc.Noise)
+			base = GetNoiseValues(thiscore);
+		else
+			coef = &interpTable[AdvanceVoice(thiscore, voiceidx)];
+
+		CalculateADSR(thiscore, voiceidx);
+		envelope = vc.ADSR.Value;
+	}
+	else
+	{
+		while (vc.SP >= 0)
+			GetNextDataDummy(thiscore, voiceidx);
+	}
+
+	batch.Coef[0][voiceidx] = (*coef)[0];
+	batch.Coef[1][voiceidx] = (*coef)[1];
+	batch.Coef[2][voiceidx] = (*coef)[2];
+	batch.Coef[3][voiceidx] = (*coef)[3];
+	batch.Sample[0][voiceidx] = static_cast<s16>(vc.PV4);
+	batch.Sample[1][voiceidx] = static_cast<s16>(vc.PV3);
+	batch.Sample[2][voiceidx] = static_cast<s16>(vc.PV2);
+	batch.Sample[3][voiceidx] = static_cast<s16>(vc.PV1);
+	batch.Base[voiceidx] = base;
+	batch.Envelope[voiceidx] = envelope;
+	batch.VolumeL[voiceidx] = vc.Volume.Left.Value;
+	batch.VolumeR[voiceidx] = vc.Volume.Right.Value;
+	batch.Active[voiceidx] = active;
+
+	// Write-back of raw voice data (post ADSR applied), done here since later voices may read it.
+	if (voiceidx == 1)
+		spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, GetBatchValue(batch, voiceidx));
+	else if (voiceidx == 3)
+		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, GetBatchValue(batch, voiceidx));
+}
+
+static __forceinline void MixVoiceBatch(VoiceMixSet& dest, V_Core& thiscore, VoiceBatch& batch)
+{
+#if defined(_M_ARM64)
+	int32x4_t dry_l = vdupq_n_s32(0);
+	int32x4_t dry_r = vdupq_n_s32(0);
+	int32x4_t wet_l = vdupq_n_s32(0);
+	int32x4_t wet_r = vdupq_n_s32(0);
+
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; voiceidx += 4)
+	{
+		int32x4_t value = vld1q_s32(&batch.Base[voiceidx]);
+		for (int i = 0; i < 4; i++)
+		{
+			const int32x4_t tap = vmull_s16(vld1_s16(&batch.Coef[i][voiceidx]), vld1_s16(&batch.Sample[i][voiceidx]));
+			value = vaddq_s32(value, vshrq_n_s32(tap, 15));
+		}
+
+		value = vshrq_n_s32(vmulq_s32(vld1q_s32(&batch.Envelope[voiceidx]), value), 15);
+		vst1q_s32(&batch.Value[voiceidx], value);
+
+		const int32x4_t left = vshrq_n_s32(vmulq_s32(vld1q_s32(&batch.VolumeL[voiceidx]), value), 15);
+		const int32x4_t right = vshrq_n_s32(vmulq_s32(vld1q_s32(&batch.VolumeR[voiceidx]), value), 15);
+
+		// Splits the gates of four voices into DryL/DryR/WetL/WetR vectors.
+		static_assert(sizeof(V_VoiceGates) == sizeof(s32) * 4);
+		const int32x4x4_t gates = vld4q_s32(&thiscore.VoiceGates[voiceidx].DryL);
+		dry_l = vaddq_s32(dry_l, vandq_s32(left, gates.val[0]));
+		dry_r = vaddq_s32(dry_r, vandq_s32(right, gates.val[1]));
+		wet_l = vaddq_s32(wet_l, vandq_s32(left, gates.val[2]));
+		wet_r = vaddq_s32(wet_r, vandq_s32(right, gates.val[3]));
+	}
+
+	dest.Dry.Left += vaddvq_s32(dry_l);
+	dest.Dry.Right += vaddvq_s32(dry_r);
+	dest.Wet.Left += vaddvq_s32(wet_l);
+	dest.Wet.Right += vaddvq_s32(wet_r);
+#else
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+		const s32 value = GetBatchValue(batch, voiceidx);
+		batch.Value[voiceidx] = value;
+
+		const s32 left = ApplyVolume(value, batch.VolumeL[voiceidx]);
+		const s32 right = ApplyVolume(value, batch.VolumeR[voiceidx]);
+		dest.Dry.Left += left & thiscore.VoiceGates[voiceidx].DryL;
+		dest.Dry.Right += right & thiscore.VoiceGates[voiceidx].DryR;
+		dest.Wet.Left += left & thiscore.VoiceGates[voiceidx].WetL;
+		dest.Wet.Right += right & thiscore.VoiceGates[voiceidx].WetR;
+	}
+#endif
+}
+
+static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
+{
+	V_Core& thiscore(Cores[coreidx]);
+
+	// Pitch modulation takes the previous voice's output of the same sample, so cores using it are
+	// mixed one voice at a time. Voice 0 can't be modulated.
+	if (thiscore.Regs.PMON & ~1u)
+	{
+		for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		{
+			StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+
+			// Note: Results from MixVoice are ranged at 16 bits.
+
+			dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
+			dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
+			dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
+			dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+		}
+		return;
+	}
+
+	VoiceBatch batch;
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		GatherVoice(batch, coreidx, voiceidx);
 
-		// Note: Results from MixVoice are ranged at 16 bits.
+	MixVoiceBatch(dest, thiscore, batch);
 
-		dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+	{
+		if (!batch.Active[voiceidx])
+			continue;
+
+		thiscore.Voices[voiceidx].OutX = batch.Value[voiceidx];
+		if (IsDevBuild)
+			DebugCores[coreidx].Voices[voiceidx].displayPeak = std::max(DebugCores[coreidx].Voices[voiceidx].displayPeak, batch.Value[voiceidx]);
 	}
 }
 
@@ -79,7 +79,7 @@ s32 __forceinline ReverbDownsample_reference(V_Core& core, bool right)
 	return clamp_mix(out);
 }
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 s32 __forceinline ReverbDownsample_avx(V_Core& core, bool right)
 {
 	int index = (core.RevbSampleBufPos - NUM_TAPS) & 63;
@@ -139,7 +139,7 @@ s32 __forceinline ReverbDownsample_sse(V_Core& core, bool right)
 
 s32 ReverbDownsample(V_Core& core, bool right)
 {
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 	return ReverbDownsample_avx(core, right);
 #else
 	return ReverbDownsample_sse(core, right);
@@ -163,7 +163,7 @@ StereoOut32 __forceinline ReverbUpsample_reference(V_Core& core)
 	return {clamp_mix(l), clamp_mix(r)};
 }
 
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 StereoOut32 __forceinline ReverbUpsample_avx(V_Core& core)
 {
 	int index = (core.RevbSampleBufPos - NUM_TAPS) & 63;
@@ -250,7 +250,7 @@ StereoOut32 __forceinline ReverbUpsample_sse(V_Core& core)
 
 StereoOut32 ReverbUpsample(V_Core& core)
 {
-#if _M_SSE >= 0x501
+#if _M_SSE >= 0x501 || _M_NEON >= 0x200
 	return ReverbUpsample_avx(core);
 #else
 	return ReverbUpsample_sse(core);
@@ -1092,6 +1092,9 @@ void VMManager::UpdateDiscDetails(bool booting)
 		s_title = std::move(title);
 	}
 
+	if (CDVDsys_GetSourceType() == CDVD_SourceType::Iso && !GSDumpReplayer::IsReplayingDump())
+		ISOsetPrefetchProfile(s_disc_serial);
+
 	Console.WriteLn(Color_StrongGreen,
 		fmt::format("Disc changed to {}.", Path::GetFileName(CDVDsys_GetFile(CDVDsys_GetSourceType()))));
 	Console.WriteLn(Color_StrongGreen, fmt::format("  Name: {}", s_title));
@@ -2339,7 +2342,7 @@ bool VMManager::IsSaveStateFileName(const std::string_view path)
 
 bool VMManager::IsDiscFileName(const std::string_view path)
 {
-	static const char* extensions[] = {".iso", ".bin", ".img", ".mdf", ".gz", ".cso", ".zso", ".chd"};
+	static const char* extensions[] = {".iso", ".bin", ".img", ".mdf", ".gz", ".cso", ".zso", ".chd", ".iso.zst"};
 
 	for (const char* test_extension : extensions)
 	{
@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: 2002-2025 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "IPU/IPU_Kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+
+// The NEON kernels have to give the same bytes as the reference ones for any input, so both are run on
+// the same random macroblocks and the outputs compared.
+
+static constexpr int ITERATIONS = 2000;
+
+static std::mt19937 s_rng(0x1b2c3d4e);
+
+static void FillRandom(void* data, size_t size)
+{
+	u8* p = static_cast<u8*>(data);
+	for (size_t i = 0; i < size; i++)
+		p[i] = static_cast<u8>(s_rng());
+}
+
+static int RandomInt(int min, int max)
+{
+	return std::uniform_int_distribution<int>(min, max)(s_rng);
+}
+
+static void ExpectSameBytes(const void* expected, const void* actual, size_t size, int iteration)
+{
+	const u8* e = static_cast<const u8*>(expected);
+	const u8* a = static_cast<const u8*>(actual);
+	for (size_t i = 0; i < size; i++)
+	{
+		if (e[i] != a[i])
+		{
+			ADD_FAILURE() << "iteration " << iteration << ": first difference at byte " << i << ", expected "
+						  << static_cast<int>(e[i]) << ", got " << static_cast<int>(a[i]);
+			return;
+		}
+	}
+}
+
+/// Coefficients as the decoder produces them, saturated to 12 bits. Some blocks only have a few
+/// coefficients set, which takes the DC only row shortcut of the reference IDCT.
+static void RandomDCTBlock(s16 (&block)[64])
+{
+	std::memset(block, 0, sizeof(block));
+
+	const int coefficients = (RandomInt(0, 3) == 0) ? 64 : RandomInt(1, 8);
+	for (int i = 0; i < coefficients; i++)
+		block[(coefficients == 64) ? i : RandomInt(0, 63)] = static_cast<s16>(RandomInt(-2048, 2047));
+
+	if (RandomInt(0, 7) == 0)
+	{
+		std::memset(block, 0, sizeof(block));
+		block[0] = static_cast<s16>(RandomInt(-2048, 2047));
+	}
+}
+
+TEST(IPUKernels, IDCTBlock)
+{
+	for (int it = 0; it < ITERATIONS; it++)
+	{
+		alignas(16) s16 expected[64];
+		alignas(16) s16 actual[64];
+		RandomDCTBlock(expected);
+		std::memcpy(actual, expected, sizeof(actual));
+
+		IDCT_Block_reference(expected);
+		IDCT_Block_neon(actual);
+		ExpectSameBytes(expected, actual, sizeof(actual), it);
+	}
+}
+
+TEST(IPUKernels, IDCTCopy)
+{
+	// The IPU writes 8x8 blocks into 16 pixel wide macroblock rows.
+	constexpr int stride = 16;
+
+	for (int it = 0; it < ITERATIONS; it++)
+	{
+		alignas(16) s16 expected_block[64];
+		alignas(16) s16 actual_block[64];
+		RandomDCTBlock(expected_block);
+		std::memcpy(actual_block, expected_block, sizeof(actual_block));
+
+		alignas(16) u8 expected_dest[stride * 8];
+		alignas(16) u8 actual_dest[stride * 8];
+		FillRandom(expected_dest, sizeof(expected_dest));
+		std::memcpy(actual_dest, expected_dest, sizeof(actual_dest));
+
+		IDCT_Copy_reference(expected_block, expected_dest, stride);
+		IDCT_Copy_neon(actual_block, actual_dest, stride);
+		ExpectSameBytes(expected_dest, actual_dest, sizeof(actual_dest), it);
+		ExpectSameBytes(expected_block, actual_block, sizeof(actual_block), it);
+	}
+}
+
+TEST(IPUKernels, CSCThresholds)
+{
+	for (int it = 0; it < ITERATIONS; it++)
+	{
+		// Thresholds are 9 bits, zero disables them.
+		u16 thresh[2];
+		for (u16& t : thresh)
+		{
+			const int kind = RandomInt(0, 3);
+			t = static_cast<u16>((kind == 0) ? 0 : ((kind == 1) ? RandomInt(256, 511) : RandomInt(1, 255)));
+		}
+		const int sgn = RandomInt(0, 1);
+
+		alignas(16) macroblock_rgb32 expected;
+		alignas(16) macroblock_rgb32 actual;
+		FillRandom(&expected, sizeof(expected));
+		std::memcpy(&actual, &expected, sizeof(actual));
+
+		ipu_csc_thresh_reference(expected, thresh, sgn);
+		ipu_csc_thresh_neon(actual, thresh, sgn);
+		ExpectSameBytes(&expected, &actual, sizeof(actual), it);
+	}
+}
+
+TEST(IPUKernels, VQ)
+{
+	for (int it = 0; it < ITERATIONS; it++)
+	{
+		rgb16_t clut[16];
+		FillRandom(clut, sizeof(clut));
+
+		// Small palettes of repeated colours have lots of ties, which have to pick the same index.
+		if (RandomInt(0, 3) == 0)
+		{
+			for (int k = 0; k < 16; k++)
+				clut[k] = clut[RandomInt(0, 3)];
+		}
+
+		alignas(16) macroblock_rgb16 rgb16;
+		FillRandom(&rgb16, sizeof(rgb16));
+
+		alignas(16) u8 expected[16 * 16 / 2];
+		alignas(16) u8 actual[16 * 16 / 2];
+		ipu_vq_reference(rgb16, clut, expected);
+		ipu_vq_neon(rgb16, clut, actual);
+		ExpectSameBytes(expected, actual, sizeof(actual), it);
+	}
+}
+
+TEST(IPUKernels, Dither)
+{
+	for (int it = 0; it < ITERATIONS; it++)
+	{
+		alignas(16) macroblock_rgb32 rgb32;
+		FillRandom(&rgb32, sizeof(rgb32));
+
+		// The alpha bit is only set for an alpha of exactly 0x40, which random bytes would rarely hit.
+		for (auto& row : rgb32.c)
+		{
+			for (auto& px : row)
+			{
+				if (RandomInt(0, 1))
+					px.a = 0x40;
+			}
+		}
+
+		const int dte = RandomInt(0, 1);
+
+		alignas(16) macroblock_rgb16 expected;
+		alignas(16) macroblock_rgb16 actual;
+		std::memset(&expected, 0, sizeof(expected));
+		std::memset(&actual, 0, sizeof(actual));
+
+		ipu_dither_reference(rgb32, expected, dte);
+		ipu_dither_neon(rgb32, actual, dte);
+		ExpectSameBytes(&expected, &actual, sizeof(actual), it);
+	}
+}